@@ -0,0 +1,28 @@
+// Copyright 2022 by Mark Melton
+//
+
+#pragma once
+#include <cstdint>
+#include <benchmark/benchmark.h>
+
+// Return the number of heap allocations made by the process so far.
+std::uint64_t allocation_count();
+
+// The **AllocationCounter** class reports the heap allocations per iteration of a
+// benchmark as the `allocs/op` counter when it goes out of scope.
+class AllocationCounter {
+public:
+    AllocationCounter(benchmark::State& state)
+	: state_(state)
+	, start_(allocation_count())
+    { }
+
+    ~AllocationCounter() {
+	state_.counters["allocs/op"] =
+	    benchmark::Counter(allocation_count() - start_, benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    benchmark::State& state_;
+    std::uint64_t start_;
+};
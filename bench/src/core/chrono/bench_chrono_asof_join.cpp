@@ -0,0 +1,36 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+#include "core/chrono/asof_join.h"
+
+using namespace chron;
+
+// Return `n` sorted timepoints over one hour.
+static std::vector<TimePoint> timepoints(std::size_t n, std::uint64_t seed) {
+    std::mt19937_64 rng{seed};
+    std::uniform_int_distribution<std::int64_t> dist{0, 3'600'000'000'000};
+    std::vector<TimePoint> tps;
+    for (std::size_t i = 0; i < n; ++i)
+	tps.push_back(TimePoint{dist(rng)});
+    std::sort(tps.begin(), tps.end());
+    return tps;
+}
+
+// Join `state.range(0)` left stamps against `state.range(1)` right stamps using
+// `state.range(2)` threads.
+static void BM_AsofJoin(benchmark::State& state) {
+    auto left = timepoints(state.range(0), 1);
+    auto right = timepoints(state.range(1), 2);
+    for (auto _ : state)
+	benchmark::DoNotOptimize(asof_join(left, right, nanos::max(), state.range(2)));
+    state.SetItemsProcessed(state.iterations() * left.size());
+}
+BENCHMARK(BM_AsofJoin)
+->Args({1 << 20, 1 << 20, 1})
+->Args({1 << 20, 1 << 20, 4})
+->Args({1 << 14, 1 << 22, 1})
+->Args({1 << 22, 1 << 14, 1})
+->Unit(benchmark::kMillisecond);
@@ -0,0 +1,68 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include "core/chrono/business_calendar.h"
+#include "core/chrono/date_stream.h"
+#include "alloc_counter.h"
+
+using namespace chron;
+
+static const std::size_t NumberSamples = 1024;
+
+static std::vector<Date> dates() {
+    std::vector<Date> ds;
+    auto g = coro::Sampler<Date>{}(jan/1/2000, dec/31/2040);
+    for (std::size_t i = 0; i < NumberSamples; ++i)
+	ds.push_back(g.sample());
+    return ds;
+}
+
+static const BusinessCalendar& calendar() {
+    static BusinessCalendar calendar{1990, 2050};
+    return calendar;
+}
+
+static void BM_BusinessCalendarIsBusinessDay(benchmark::State& state) {
+    auto ds = dates();
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(calendar().is_business_day(ds[i++ % ds.size()]));
+}
+BENCHMARK(BM_BusinessCalendarIsBusinessDay);
+
+static void BM_BusinessCalendarBetween(benchmark::State& state) {
+    auto ds = dates();
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state) {
+	auto& a = ds[i++ % ds.size()];
+	auto& b = ds[i % ds.size()];
+	benchmark::DoNotOptimize(calendar().business_days_between(a, b));
+    }
+}
+BENCHMARK(BM_BusinessCalendarBetween);
+
+static void BM_BusinessCalendarAdd(benchmark::State& state) {
+    auto ds = dates();
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(calendar().add_business_days(ds[i++ % ds.size()], state.range(0)));
+}
+BENCHMARK(BM_BusinessCalendarAdd)->Arg(1)->Arg(250)->Arg(2500);
+
+// The day-by-day loop the calendar replaces.
+static void BM_BusinessCalendarAddLoop(benchmark::State& state) {
+    auto ds = dates();
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state) {
+	auto date = ds[i++ % ds.size()];
+	for (auto n = state.range(0); n > 0; --n)
+	    while (not calendar().is_business_day(++date));
+	benchmark::DoNotOptimize(date);
+    }
+}
+BENCHMARK(BM_BusinessCalendarAddLoop)->Arg(1)->Arg(250)->Arg(2500);
@@ -0,0 +1,92 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include "core/chrono/chrono.h"
+#include "core/chrono/date_stream.h"
+#include "alloc_counter.h"
+
+using namespace chron;
+
+static const std::size_t NumberSamples = 1024;
+
+static std::vector<Date> dates() {
+    std::vector<Date> ds;
+    auto g = coro::Sampler<Date>{}();
+    for (std::size_t i = 0; i < NumberSamples; ++i)
+	ds.push_back(g.sample());
+    return ds;
+}
+
+static void BM_DateParse(benchmark::State& state) {
+    std::vector<std::string> strs;
+    for (auto date : dates())
+	strs.push_back(fmt::format("{}", date));
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(Date{strs[i++ % strs.size()]});
+}
+BENCHMARK(BM_DateParse);
+
+static void BM_DateFormat(benchmark::State& state) {
+    auto ds = dates();
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(fmt::format("{}", ds[i++ % ds.size()]));
+}
+BENCHMARK(BM_DateFormat);
+
+static void BM_DateAddDays(benchmark::State& state) {
+    auto ds = dates();
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(ds[i++ % ds.size()] + days{17});
+}
+BENCHMARK(BM_DateAddDays);
+
+static void BM_DateDifference(benchmark::State& state) {
+    auto ds = dates();
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state) {
+	auto& a = ds[i++ % ds.size()];
+	auto& b = ds[i % ds.size()];
+	benchmark::DoNotOptimize(a - b);
+    }
+}
+BENCHMARK(BM_DateDifference);
+
+static void BM_DateIncrement(benchmark::State& state) {
+    Date date = jan/1/2000;
+    AllocationCounter counter{state};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(++date);
+}
+BENCHMARK(BM_DateIncrement);
+
+static void BM_DateIterateYear(benchmark::State& state) {
+    Date begin = jan/1/2000, end = jan/1/2001;
+    AllocationCounter counter{state};
+    for (auto _ : state) {
+	int count{0};
+	for (auto date = begin; date != end; ++date)
+	    count += (unsigned)date.day();
+	benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * (end - begin).count());
+}
+BENCHMARK(BM_DateIterateYear);
+
+static void BM_DateToTimePoint(benchmark::State& state, const char *tz) {
+    TimeZoneName tzname{tz};
+    auto ds = dates();
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(ds[i++ % ds.size()].to_timepoint(tzname));
+}
+BENCHMARK_CAPTURE(BM_DateToTimePoint, utc, "UTC");
+BENCHMARK_CAPTURE(BM_DateToTimePoint, new_york, "America/New_York");
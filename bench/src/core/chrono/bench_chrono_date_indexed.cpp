@@ -0,0 +1,128 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include "core/chrono/date_indexed.h"
+#include "core/chrono/timepoint.h"
+
+using namespace chron;
+
+// The hash of the standard library for integers, which is the identity.
+template<class T>
+struct RawHash {
+    std::size_t operator()(const T& key) const;
+};
+
+template<> std::size_t RawHash<Date>::operator()(const Date& date) const {
+    return date::sys_days{date}.time_since_epoch().count();
+}
+
+template<> std::size_t RawHash<TimePoint>::operator()(const TimePoint& tp) const {
+    return tp.time_since_epoch().count();
+}
+
+// A minimal open-addressing table with linear probing and a power-of-two capacity at
+// most half full, which is where a poorly mixed hash shows up as long probe sequences.
+template<class K, class V, class Hash>
+class FlatMap {
+public:
+    FlatMap(std::size_t n)
+	: mask_(std::bit_ceil(2 * n) - 1)
+	, slots_(mask_ + 1) {
+    }
+
+    void insert(const K& key, const V& value) {
+	auto i = Hash{}(key) & mask_;
+	while (slots_[i] and slots_[i]->first != key)
+	    i = (i + 1) & mask_;
+	slots_[i] = std::pair{key, value};
+    }
+
+    const V *find(const K& key) const {
+	for (auto i = Hash{}(key) & mask_; slots_[i]; i = (i + 1) & mask_)
+	    if (slots_[i]->first == key)
+		return &slots_[i]->second;
+	return nullptr;
+    }
+
+private:
+    std::size_t mask_;
+    std::vector<std::optional<std::pair<K,V>>> slots_;
+};
+
+static const std::size_t NumberKeys = 1 << 14;
+
+// Consecutive days from 2000 on.
+static std::vector<Date> date_keys() {
+    std::vector<Date> dates;
+    for (std::size_t i = 0; i < NumberKeys; ++i)
+	dates.push_back(Date{2000, 1, 1} + days{i});
+    return dates;
+}
+
+// Timestamps on a millisecond grid.
+static std::vector<TimePoint> timepoint_keys() {
+    std::vector<TimePoint> tps;
+    for (std::size_t i = 0; i < NumberKeys; ++i)
+	tps.push_back("2024-01-02 09:30:00"_utc + millis{i});
+    return tps;
+}
+
+template<class Map, class K>
+static void lookup(benchmark::State& state, const Map& map, const std::vector<K>& keys) {
+    std::size_t i{0};
+    for (auto _ : state) {
+	benchmark::DoNotOptimize(map.find(keys[i]));
+	i = (i + 7919) & (keys.size() - 1);
+    }
+}
+
+template<class Hash>
+static void BM_FlatMapDate(benchmark::State& state) {
+    auto keys = date_keys();
+    FlatMap<Date, int, Hash> map{keys.size()};
+    for (const auto& key : keys)
+	map.insert(key, 1);
+    lookup(state, map, keys);
+}
+BENCHMARK(BM_FlatMapDate<RawHash<Date>>);
+BENCHMARK(BM_FlatMapDate<std::hash<Date>>);
+
+template<class Hash>
+static void BM_FlatMapTimePoint(benchmark::State& state) {
+    auto keys = timepoint_keys();
+    FlatMap<TimePoint, int, Hash> map{keys.size()};
+    for (const auto& key : keys)
+	map.insert(key, 1);
+    lookup(state, map, keys);
+}
+BENCHMARK(BM_FlatMapTimePoint<RawHash<TimePoint>>);
+BENCHMARK(BM_FlatMapTimePoint<std::hash<TimePoint>>);
+
+static void BM_DateMap(benchmark::State& state) {
+    auto keys = date_keys();
+    std::map<Date, int> map;
+    for (const auto& key : keys)
+	map.emplace(key, 1);
+    lookup(state, map, keys);
+}
+BENCHMARK(BM_DateMap);
+
+static void BM_DateUnorderedMap(benchmark::State& state) {
+    auto keys = date_keys();
+    std::unordered_map<Date, int> map;
+    for (const auto& key : keys)
+	map.emplace(key, 1);
+    lookup(state, map, keys);
+}
+BENCHMARK(BM_DateUnorderedMap);
+
+static void BM_DateIndexed(benchmark::State& state) {
+    auto keys = date_keys();
+    DateIndexed<int> map{keys.front(), keys.back(), 1};
+    lookup(state, map, keys);
+}
+BENCHMARK(BM_DateIndexed);
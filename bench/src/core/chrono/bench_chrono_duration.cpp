@@ -0,0 +1,28 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <sstream>
+#include "core/chrono/duration.h"
+#include "alloc_counter.h"
+
+using namespace chron;
+
+template<class Duration>
+static void BM_DurationPrint(benchmark::State& state) {
+    std::vector<Duration> durations;
+    for (std::int64_t n = 1; durations.size() < 64; n = 3 * n + 1)
+	durations.push_back(Duration{n % 1'000'000'000});
+
+    std::ostringstream ss;
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state) {
+	ss.seekp(0);
+	std::chrono::operator<< <Duration>(ss, durations[i++ % durations.size()]);
+    }
+}
+BENCHMARK_TEMPLATE(BM_DurationPrint, nanos);
+BENCHMARK_TEMPLATE(BM_DurationPrint, micros);
+BENCHMARK_TEMPLATE(BM_DurationPrint, millis);
+BENCHMARK_TEMPLATE(BM_DurationPrint, seconds);
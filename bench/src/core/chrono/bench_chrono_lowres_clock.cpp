@@ -0,0 +1,50 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include "core/chrono/lowres_clock.h"
+#include "alloc_counter.h"
+
+using namespace chron;
+
+static void BM_LowResClockNow(benchmark::State& state) {
+    static LowResClock clock{LowResClock::Mode::RealTime, millis{1}};
+    AllocationCounter counter{state};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(clock.now());
+}
+BENCHMARK(BM_LowResClockNow)->ThreadRange(1, 8);
+
+static void BM_LowResClockVirtualNow(benchmark::State& state) {
+    static LowResClock clock{LowResClock::Mode::RealTime, millis{1}};
+    AllocationCounter counter{state};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(clock.virtual_now());
+}
+BENCHMARK(BM_LowResClockVirtualNow);
+
+static void BM_LowResClockTimeOfDay(benchmark::State& state) {
+    static LowResClock clock{LowResClock::Mode::RealTime, millis{1}};
+    static auto zone = clock.add_zone(TimeZoneName{"America/New_York"});
+    AllocationCounter counter{state};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(clock.time_of_day(zone));
+}
+BENCHMARK(BM_LowResClockTimeOfDay)->ThreadRange(1, 8);
+
+static void BM_LowResClockToday(benchmark::State& state) {
+    static LowResClock clock{LowResClock::Mode::RealTime, millis{1}};
+    static auto zone = clock.add_zone(TimeZoneName{"America/New_York"});
+    AllocationCounter counter{state};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(clock.today(zone));
+}
+BENCHMARK(BM_LowResClockToday);
+
+static void BM_DateToday(benchmark::State& state) {
+    TimeZoneName tzname{"America/New_York"};
+    AllocationCounter counter{state};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(Date{tzname});
+}
+BENCHMARK(BM_DateToday);
@@ -0,0 +1,51 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include "core/chrono/concurrent_periodically.h"
+#include "core/chrono/lowres_clock.h"
+
+using namespace chron;
+
+// Each thread owns its own Periodically which is the only option without a shared gate.
+static void BM_Periodically(benchmark::State& state) {
+    Periodically periodic{1ms};
+    std::int64_t fired{0};
+    for (auto _ : state)
+	fired += periodic();
+    state.counters["fired"] = benchmark::Counter(fired, benchmark::Counter::kAvgThreads);
+}
+BENCHMARK(BM_Periodically)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_PeriodicallyCheckInterval(benchmark::State& state) {
+    Periodically periodic{1ms, 64};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(periodic());
+}
+BENCHMARK(BM_PeriodicallyCheckInterval)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_PeriodicallyLowResClock(benchmark::State& state) {
+    static LowResClock clock{LowResClock::Mode::RealTime, 1ms};
+    BasicPeriodically<ClockTimeSource<LowResClock>> periodic{1ms, clock};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(periodic());
+}
+BENCHMARK(BM_PeriodicallyLowResClock)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_ConcurrentPeriodically(benchmark::State& state) {
+    static ConcurrentPeriodically periodic{1ms};
+    std::int64_t fired{0};
+    for (auto _ : state)
+	fired += periodic();
+    state.counters["fired"] = benchmark::Counter(fired, benchmark::Counter::kAvgThreads);
+}
+BENCHMARK(BM_ConcurrentPeriodically)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_TokenBucket(benchmark::State& state) {
+    static TokenBucket bucket{1000, 1ms};
+    std::int64_t fired{0};
+    for (auto _ : state)
+	fired += bucket();
+    state.counters["fired"] = benchmark::Counter(fired, benchmark::Counter::kAvgThreads);
+}
+BENCHMARK(BM_TokenBucket)->ThreadRange(1, 64)->UseRealTime();
@@ -0,0 +1,61 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include "core/chrono/resample.h"
+#include "alloc_counter.h"
+
+using namespace chron;
+
+static const std::size_t NumberSamples = 4096;
+
+// Return sorted timepoints spread over `span` starting from the first trading day of 2024.
+static std::vector<TimePoint> timepoints(nanos span) {
+    std::vector<TimePoint> tps;
+    TimePoint start{jan/2/2024, TimeOfDay{9, 30, 0}, TimeZoneName{"America/New_York"}};
+    auto step = span / NumberSamples;
+    for (std::size_t i = 0; i < NumberSamples; ++i)
+	tps.push_back(start + i * step);
+    return tps;
+}
+
+static void BM_BucketerBucket(benchmark::State& state, nanos width) {
+    Bucketer bucketer{width, TimeZoneName{"America/New_York"}};
+    auto tps = timepoints(std::chrono::hours{6});
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(bucketer.bucket(tps[i++ % tps.size()]));
+}
+BENCHMARK_CAPTURE(BM_BucketerBucket, 1s, std::chrono::seconds{1});
+BENCHMARK_CAPTURE(BM_BucketerBucket, 5min, std::chrono::minutes{5});
+
+static void BM_BucketerBucketize(benchmark::State& state, Bucketer bucketer) {
+    auto tps = timepoints(std::chrono::hours{6 * 24});
+    std::vector<std::int64_t> ids(tps.size());
+    AllocationCounter counter{state};
+    for (auto _ : state) {
+	bucketer.bucketize(tps, ids);
+	benchmark::DoNotOptimize(ids.data());
+    }
+    state.SetItemsProcessed(state.iterations() * tps.size());
+}
+BENCHMARK_CAPTURE(BM_BucketerBucketize, 5min,
+		  Bucketer{std::chrono::minutes{5}, TimeZoneName{"America/New_York"}});
+BENCHMARK_CAPTURE(BM_BucketerBucketize, month,
+		  Bucketer{Bucketer::Period::Month, TimeZoneName{"America/New_York"}});
+
+static void BM_ResamplerAdd(benchmark::State& state) {
+    Resampler resampler{Bucketer{std::chrono::minutes{1}, TimeZoneName{"America/New_York"}}};
+    auto tps = timepoints(std::chrono::hours{6});
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state) {
+	auto n = i++ % tps.size();
+	if (n == 0)
+	    resampler.flush();
+	benchmark::DoNotOptimize(resampler.add(tps[n], double(n)));
+    }
+}
+BENCHMARK(BM_ResamplerAdd);
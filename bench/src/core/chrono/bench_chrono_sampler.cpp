@@ -0,0 +1,100 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include "core/chrono/arrival_stream.h"
+#include "core/chrono/chrono_stream.h"
+
+using namespace chron;
+using namespace coro;
+
+static const std::size_t NumberSamples = 1 << 16;
+
+static void BM_SamplerTimePointGenerator(benchmark::State& state) {
+    std::vector<TimePoint> out(NumberSamples);
+    auto g = Sampler<TimePoint>{}();
+    for (auto _ : state) {
+	for (auto& tp : out)
+	    tp = g.sample();
+	benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * out.size());
+}
+BENCHMARK(BM_SamplerTimePointGenerator);
+
+static void BM_SamplerTimePointFill(benchmark::State& state) {
+    std::vector<TimePoint> out(NumberSamples);
+    std::uint64_t seed{0};
+    for (auto _ : state) {
+	Sampler<TimePoint>::fill(out, TimePoint{jan/1/1990}, TimePoint{jan/1/2040}, ++seed);
+	benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * out.size());
+}
+BENCHMARK(BM_SamplerTimePointFill);
+
+static void BM_SamplerDateGenerator(benchmark::State& state) {
+    std::vector<Date> out(NumberSamples, jan/1/2000);
+    auto g = Sampler<Date>{}();
+    for (auto _ : state) {
+	for (auto& date : out)
+	    date = g.sample();
+	benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * out.size());
+}
+BENCHMARK(BM_SamplerDateGenerator);
+
+static void BM_SamplerDateFill(benchmark::State& state) {
+    std::vector<Date> out(NumberSamples, jan/1/2000);
+    std::uint64_t seed{0};
+    for (auto _ : state) {
+	Sampler<Date>::fill(out, jan/1/1990, jan/1/2040, ++seed);
+	benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * out.size());
+}
+BENCHMARK(BM_SamplerDateFill);
+
+static void BM_SamplerDurationFill(benchmark::State& state) {
+    std::vector<millis> out(NumberSamples);
+    std::uint64_t seed{0};
+    for (auto _ : state) {
+	Sampler<millis>::fill(out, millis{0}, millis{1000}, ++seed);
+	benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * out.size());
+}
+BENCHMARK(BM_SamplerDurationFill);
+
+static void BM_ArrivalFill(benchmark::State& state, auto process) {
+    std::vector<TimePoint> out(NumberSamples);
+    TimePoint start{jan/2/2024, TimeZoneName{"America/New_York"}};
+    std::uint64_t seed{0};
+    for (auto _ : state) {
+	process.fill(out, start, ++seed);
+	benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * out.size());
+}
+BENCHMARK_CAPTURE(BM_ArrivalFill, poisson, PoissonArrivals{1000.0});
+BENCHMARK_CAPTURE(BM_ArrivalFill, hawkes, HawkesArrivals{200.0, 0.8, millis{10}});
+BENCHMARK_CAPTURE(BM_ArrivalFill, session,
+		  SessionArrivals{100.0, TimeOfDay{9, 30, 0}, TimeOfDay{16, 0, 0},
+				  TimeZoneName{"America/New_York"}});
+
+// Compare converting realistic session traffic to dates against converting uniformly
+// random instants over the same span.
+static void BM_ArrivalDate(benchmark::State& state, bool sorted) {
+    TimeZoneName tzname{"America/New_York"};
+    std::vector<TimePoint> tps(NumberSamples);
+    SessionArrivals{1.0, TimeOfDay{9, 30, 0}, TimeOfDay{16, 0, 0}, tzname}
+	.fill(tps, TimePoint{jan/2/2024, tzname}, 1);
+    if (not sorted)
+	Sampler<TimePoint>::fill(tps, tps.front(), tps.back(), 1);
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(tps[i++ % tps.size()].date(tzname));
+}
+BENCHMARK_CAPTURE(BM_ArrivalDate, session, true);
+BENCHMARK_CAPTURE(BM_ArrivalDate, uniform, false);
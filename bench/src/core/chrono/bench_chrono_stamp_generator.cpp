@@ -0,0 +1,41 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <mutex>
+#include "core/chrono/stamp_generator.h"
+
+using namespace chron;
+
+// The baseline: a mutex around the clock and the last stamp.
+static void BM_StampMutex(benchmark::State& state) {
+    static std::mutex mutex;
+    static TimePoint last;
+    for (auto _ : state) {
+	std::lock_guard lock(mutex);
+	last = std::max(TimePoint::now(), last + nanos{1});
+	benchmark::DoNotOptimize(last);
+    }
+}
+BENCHMARK(BM_StampMutex)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_AtomicStampGenerator(benchmark::State& state) {
+    static AtomicStampGenerator generator;
+    for (auto _ : state)
+	benchmark::DoNotOptimize(generator());
+}
+BENCHMARK(BM_AtomicStampGenerator)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_StampGenerator(benchmark::State& state) {
+    static StampGenerator generator{64};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(generator());
+}
+BENCHMARK(BM_StampGenerator)->ThreadRange(1, 64)->UseRealTime();
+
+static void BM_StampGeneratorFewSlots(benchmark::State& state) {
+    static StampGenerator generator{4};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(generator());
+}
+BENCHMARK(BM_StampGeneratorFewSlots)->ThreadRange(1, 64)->UseRealTime();
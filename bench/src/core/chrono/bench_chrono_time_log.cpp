@@ -0,0 +1,48 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include "core/chrono/time_log.h"
+
+using namespace chron;
+
+static const TimeZoneName NewYork{"America/New_York"};
+
+// The baseline: formatting on the producing thread.
+static void BM_TimeLogFormatInline(benchmark::State& state) {
+    auto tp = TimePoint::now();
+    for (auto _ : state) {
+	benchmark::DoNotOptimize(tp.to_string(NewYork));
+	tp += nanos{1};
+    }
+}
+BENCHMARK(BM_TimeLogFormatInline);
+
+static void BM_TimeLogRecordDisabled(benchmark::State& state) {
+    auto zone = TimeLog::zone_id(NewYork);
+    for (auto _ : state) {
+	TimeLog::instance().record(TimePoint::now(), zone);
+	benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_TimeLogRecordDisabled);
+
+template<TimeLog::Output Output>
+static void BM_TimeLogRecord(benchmark::State& state) {
+    auto path = "/tmp/chrono_bench_time_log";
+    auto zone = TimeLog::zone_id(NewYork);
+    if (state.thread_index() == 0)
+	TimeLog::instance().start(path, Output, millis{1}, 1 << 20);
+    for (auto _ : state) {
+	TimeLog::instance().record(TimePoint::now(), zone);
+	benchmark::ClobberMemory();
+    }
+    if (state.thread_index() == 0) {
+	TimeLog::instance().stop();
+	state.counters["dropped"] = TimeLog::instance().dropped();
+	std::remove(path);
+    }
+}
+BENCHMARK(BM_TimeLogRecord<TimeLog::Output::Text>)->ThreadRange(1, 8);
+BENCHMARK(BM_TimeLogRecord<TimeLog::Output::Binary>)->ThreadRange(1, 8);
@@ -0,0 +1,72 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <sstream>
+#include "core/chrono/time_of_day_stream.h"
+#include "alloc_counter.h"
+
+using namespace chron;
+
+static const std::size_t NumberSamples = 1024;
+
+static std::vector<TimeOfDay> times_of_day() {
+    std::vector<TimeOfDay> tods;
+    auto g = coro::Sampler<TimeOfDay>{}();
+    for (std::size_t i = 0; i < NumberSamples; ++i)
+	tods.push_back(g.sample());
+    return tods;
+}
+
+static void BM_TimeOfDayParse(benchmark::State& state) {
+    std::vector<std::string> strs;
+    for (auto tod : times_of_day()) {
+	std::ostringstream ss;
+	ss << tod;
+	strs.push_back(ss.str());
+    }
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(TimeOfDay{strs[i++ % strs.size()]});
+}
+BENCHMARK(BM_TimeOfDayParse);
+
+static void BM_TimeOfDayPrint(benchmark::State& state) {
+    auto tods = times_of_day();
+    std::ostringstream ss;
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state) {
+	ss.seekp(0);
+	ss << tods[i++ % tods.size()];
+    }
+}
+BENCHMARK(BM_TimeOfDayPrint);
+
+static void BM_TimeOfDayCompare(benchmark::State& state) {
+    auto tods = times_of_day();
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state) {
+	auto& a = tods[i++ % tods.size()];
+	auto& b = tods[i % tods.size()];
+	benchmark::DoNotOptimize(a < b);
+    }
+}
+BENCHMARK(BM_TimeOfDayCompare);
+
+static void BM_TimeOfDaySort(benchmark::State& state) {
+    auto tods = times_of_day();
+    AllocationCounter counter{state};
+    for (auto _ : state) {
+	state.PauseTiming();
+	auto copy = tods;
+	state.ResumeTiming();
+	std::sort(copy.begin(), copy.end());
+	benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * tods.size());
+}
+BENCHMARK(BM_TimeOfDaySort);
@@ -0,0 +1,126 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include "core/chrono/timepoint_stream.h"
+#include "core/chrono/zoned_timepoint.h"
+#include "alloc_counter.h"
+
+using namespace chron;
+
+static const std::size_t NumberSamples = 1024;
+
+static std::vector<TimePoint> timepoints() {
+    std::vector<TimePoint> tps;
+    auto g = coro::Sampler<TimePoint>{}(TimePoint{jan/1/2000}, TimePoint{jan/1/2030});
+    for (std::size_t i = 0; i < NumberSamples; ++i)
+	tps.push_back(g.sample());
+    return tps;
+}
+
+static std::vector<std::string> timepoint_strings(const TimeZoneName& tzname) {
+    std::vector<std::string> strs;
+    for (auto tp : timepoints())
+	strs.push_back(tp.to_string(tzname));
+    return strs;
+}
+
+template<class F>
+static void run(benchmark::State& state, const std::vector<TimePoint>& tps, F&& func) {
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(func(tps[i++ % tps.size()]));
+}
+
+static void BM_TimePointParse(benchmark::State& state, const char *tz) {
+    TimeZoneName tzname{tz};
+    auto strs = timepoint_strings(tzname);
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(TimePoint{strs[i++ % strs.size()], tzname});
+}
+BENCHMARK_CAPTURE(BM_TimePointParse, utc, "UTC");
+BENCHMARK_CAPTURE(BM_TimePointParse, new_york, "America/New_York");
+
+template<class Zone>
+static void BM_TimePointToString(benchmark::State& state, Zone zone) {
+    run(state, timepoints(), [&](TimePoint tp) { return tp.to_string(zone); });
+}
+BENCHMARK_CAPTURE(BM_TimePointToString, utc, TimeZoneName{"UTC"});
+BENCHMARK_CAPTURE(BM_TimePointToString, new_york, TimeZoneName{"America/New_York"});
+BENCHMARK_CAPTURE(BM_TimePointToString, utc_tag, Utc{});
+BENCHMARK_CAPTURE(BM_TimePointToString, fixed_offset, FixedOffset{"-05:00"});
+
+template<class Zone>
+static void BM_TimePointDate(benchmark::State& state, Zone zone) {
+    run(state, timepoints(), [&](TimePoint tp) { return tp.date(zone); });
+}
+BENCHMARK_CAPTURE(BM_TimePointDate, utc, TimeZoneName{"UTC"});
+BENCHMARK_CAPTURE(BM_TimePointDate, new_york, TimeZoneName{"America/New_York"});
+BENCHMARK_CAPTURE(BM_TimePointDate, utc_tag, Utc{});
+BENCHMARK_CAPTURE(BM_TimePointDate, fixed_offset, FixedOffset{"-05:00"});
+
+template<class Zone>
+static void BM_TimePointTimeOfDay(benchmark::State& state, Zone zone) {
+    run(state, timepoints(), [&](TimePoint tp) { return tp.time_of_day(zone); });
+}
+BENCHMARK_CAPTURE(BM_TimePointTimeOfDay, utc, TimeZoneName{"UTC"});
+BENCHMARK_CAPTURE(BM_TimePointTimeOfDay, new_york, TimeZoneName{"America/New_York"});
+BENCHMARK_CAPTURE(BM_TimePointTimeOfDay, utc_tag, Utc{});
+BENCHMARK_CAPTURE(BM_TimePointTimeOfDay, fixed_offset, FixedOffset{"-05:00"});
+
+template<class Zone>
+static void BM_TimePointComponents(benchmark::State& state, Zone zone) {
+    run(state, timepoints(), [&](TimePoint tp) { return tp.components(zone); });
+}
+BENCHMARK_CAPTURE(BM_TimePointComponents, utc, TimeZoneName{"UTC"});
+BENCHMARK_CAPTURE(BM_TimePointComponents, new_york, TimeZoneName{"America/New_York"});
+BENCHMARK_CAPTURE(BM_TimePointComponents, utc_tag, Utc{});
+BENCHMARK_CAPTURE(BM_TimePointComponents, fixed_offset, FixedOffset{"-05:00"});
+
+template<class Zone>
+static void BM_TimePointMidnight(benchmark::State& state, Zone zone) {
+    run(state, timepoints(), [&](TimePoint tp) { return tp.midnight(zone); });
+}
+BENCHMARK_CAPTURE(BM_TimePointMidnight, utc, TimeZoneName{"UTC"});
+BENCHMARK_CAPTURE(BM_TimePointMidnight, new_york, TimeZoneName{"America/New_York"});
+BENCHMARK_CAPTURE(BM_TimePointMidnight, utc_tag, Utc{});
+BENCHMARK_CAPTURE(BM_TimePointMidnight, fixed_offset, FixedOffset{"-05:00"});
+
+template<class Zone>
+static void BM_TimePointNextMidnight(benchmark::State& state, Zone zone) {
+    run(state, timepoints(), [&](TimePoint tp) { return tp.next_midnight(zone); });
+}
+BENCHMARK_CAPTURE(BM_TimePointNextMidnight, utc, TimeZoneName{"UTC"});
+BENCHMARK_CAPTURE(BM_TimePointNextMidnight, new_york, TimeZoneName{"America/New_York"});
+BENCHMARK_CAPTURE(BM_TimePointNextMidnight, utc_tag, Utc{});
+BENCHMARK_CAPTURE(BM_TimePointNextMidnight, fixed_offset, FixedOffset{"-05:00"});
+
+static void BM_ZonedTimePointConstruct(benchmark::State& state, const char *tz) {
+    TimeZoneName tzname{tz};
+    run(state, timepoints(), [&](TimePoint tp) { return ZonedTimePoint{tp, tzname}; });
+}
+BENCHMARK_CAPTURE(BM_ZonedTimePointConstruct, utc, "UTC");
+BENCHMARK_CAPTURE(BM_ZonedTimePointConstruct, new_york, "America/New_York");
+
+static void BM_ZonedTimePointComponents(benchmark::State& state, const char *tz) {
+    TimeZoneName tzname{tz};
+    std::vector<ZonedTimePoint> ztps;
+    for (auto tp : timepoints())
+	ztps.emplace_back(tp, tzname);
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(ztps[i++ % ztps.size()].components());
+}
+BENCHMARK_CAPTURE(BM_ZonedTimePointComponents, utc, "UTC");
+BENCHMARK_CAPTURE(BM_ZonedTimePointComponents, new_york, "America/New_York");
+
+static void BM_TimePointNow(benchmark::State& state) {
+    AllocationCounter counter{state};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(TimePoint::now());
+}
+BENCHMARK(BM_TimePointNow);
@@ -0,0 +1,64 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+#include "core/chrono/timepoint_sort.h"
+#include "alloc_counter.h"
+
+using namespace chron;
+
+// Return `n` unsorted timepoints spread over one trading day.
+static std::vector<TimePoint> timepoints(std::size_t n) {
+    std::mt19937_64 rng{42};
+    std::uniform_int_distribution<std::int64_t> dist{0, 6'500'000'000'000};
+    auto start = TimePoint{jan/2/2024, TimeOfDay{9, 30, 0}}.time_since_epoch().count();
+    std::vector<TimePoint> tps;
+    for (std::size_t i = 0; i < n; ++i)
+	tps.push_back(TimePoint{start + dist(rng)});
+    return tps;
+}
+
+static void BM_TimePointStdSort(benchmark::State& state) {
+    auto input = timepoints(state.range(0));
+    for (auto _ : state) {
+	auto tps = input;
+	std::sort(tps.begin(), tps.end());
+	benchmark::DoNotOptimize(tps.data());
+    }
+    state.SetItemsProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_TimePointStdSort)->Range(1 << 10, 1 << 20);
+
+static void BM_TimePointRadixSort(benchmark::State& state) {
+    auto input = timepoints(state.range(0));
+    for (auto _ : state) {
+	auto tps = input;
+	radix_sort(tps);
+	benchmark::DoNotOptimize(tps.data());
+    }
+    state.SetItemsProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_TimePointRadixSort)->Range(1 << 10, 1 << 20);
+
+static void BM_TimePointMerge(benchmark::State& state) {
+    auto k = state.range(0);
+    std::vector<std::vector<TimePoint>> feeds;
+    std::vector<std::span<const TimePoint>> inputs;
+    for (auto i = 0; i < k; ++i) {
+	feeds.push_back(timepoints((1 << 20) / k));
+	std::sort(feeds.back().begin(), feeds.back().end());
+    }
+    for (const auto& feed : feeds)
+	inputs.push_back(feed);
+
+    std::vector<TimePoint> output((1 << 20) / k * k);
+    AllocationCounter counter{state};
+    for (auto _ : state) {
+	merge_sorted(inputs, output);
+	benchmark::DoNotOptimize(output.data());
+    }
+    state.SetItemsProcessed(state.iterations() * output.size());
+}
+BENCHMARK(BM_TimePointMerge)->RangeMultiplier(4)->Range(2, 128);
@@ -0,0 +1,64 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include "core/chrono/timestamp_index.h"
+#include "alloc_counter.h"
+
+using namespace chron;
+
+static const std::size_t NumberTimestamps = 1 << 22;
+
+// Return a month of sorted timestamps with trading-hours clustering.
+static const std::vector<TimePoint>& timepoints() {
+    static std::vector<TimePoint> tps = []() {
+	std::mt19937_64 rng{42};
+	std::uniform_int_distribution<std::int64_t> day{0, 30};
+	std::normal_distribution<double> tod{12.5 * 3600e9, 2 * 3600e9};
+	auto start = TimePoint{jan/1/2024}.time_since_epoch().count();
+	std::vector<TimePoint> tps;
+	for (std::size_t i = 0; i < NumberTimestamps; ++i)
+	    tps.push_back(TimePoint{start + day(rng) * 86'400'000'000'000 + std::int64_t(tod(rng))});
+	std::sort(tps.begin(), tps.end());
+	return tps;
+    }();
+    return tps;
+}
+
+static std::vector<TimePoint> queries() {
+    const auto& tps = timepoints();
+    std::mt19937_64 rng{7};
+    std::uniform_int_distribution<std::int64_t> dist{tps.front().time_since_epoch().count(),
+						     tps.back().time_since_epoch().count()};
+    std::vector<TimePoint> qs;
+    for (auto i = 0; i < 4096; ++i)
+	qs.push_back(TimePoint{dist(rng)});
+    return qs;
+}
+
+static void BM_TimestampIndexStdLowerBound(benchmark::State& state) {
+    const auto& tps = timepoints();
+    auto qs = queries();
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(std::lower_bound(tps.begin(), tps.end(), qs[i++ % qs.size()]));
+}
+BENCHMARK(BM_TimestampIndexStdLowerBound);
+
+static void BM_TimestampIndexLowerBound(benchmark::State& state) {
+    auto path = (std::filesystem::temp_directory_path() / "bench_timestamp_index.idx").string();
+    TimestampIndex::write(path, timepoints(), state.range(0));
+    TimestampIndex index{path};
+    auto qs = queries();
+    AllocationCounter counter{state};
+    std::size_t i{0};
+    for (auto _ : state)
+	benchmark::DoNotOptimize(index.lower_bound(qs[i++ % qs.size()]));
+    state.counters["segments"] = index.segments();
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_TimestampIndexLowerBound)->Arg(8)->Arg(32)->Arg(128);
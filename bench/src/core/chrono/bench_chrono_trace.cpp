@@ -0,0 +1,34 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include "core/chrono/trace.h"
+
+using namespace chron;
+
+static void BM_TraceSpanDisabled(benchmark::State& state) {
+    static const auto id = Tracer::name_id("disabled");
+    for (auto _ : state) {
+	TraceSpan span{id};
+	benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_TraceSpanDisabled);
+
+static void BM_TraceSpan(benchmark::State& state) {
+    static const auto id = Tracer::name_id("enabled");
+    auto path = "/tmp/chrono_bench_trace.json";
+    if (state.thread_index() == 0)
+	Tracer::instance().start(path, millis{1}, 1 << 20);
+    for (auto _ : state) {
+	TraceSpan span{id};
+	benchmark::ClobberMemory();
+    }
+    if (state.thread_index() == 0) {
+	Tracer::instance().stop();
+	state.counters["dropped"] = Tracer::instance().dropped();
+	std::remove(path);
+    }
+}
+BENCHMARK(BM_TraceSpan)->ThreadRange(1, 8);
@@ -0,0 +1,162 @@
+// Copyright 2022 by Mark Melton
+//
+
+// Compare the quality of the available time sources while a configurable number of cores
+// run a background load. For each source report the cost of a read, the number of
+// monotonicity violations, the staleness relative to the reference clock of the same
+// epoch and, for LowResClock, the wakeup jitter of the ticker thread.
+//
+//     chrono_clock_quality [--load N] [--reads N] [--millis N]
+
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <fmt/format.h>
+#include <time.h>
+#include "core/chrono/latency_histogram.h"
+#include "core/chrono/lowres_clock.h"
+#include "core/chrono/tsc_clock.h"
+
+using namespace chron;
+
+struct Source {
+    std::string name;
+    std::function<std::int64_t()> read;
+    std::function<std::int64_t()> reference;
+    const LowResClock *lowres{nullptr};
+};
+
+static std::int64_t system_nanos() {
+    return std::chrono::system_clock::now().time_since_epoch().count();
+}
+
+static std::int64_t steady_nanos() {
+    return std::chrono::duration_cast<nanos>
+	(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#ifdef CLOCK_REALTIME_COARSE
+static std::int64_t posix_nanos(clockid_t id) {
+    timespec ts;
+    clock_gettime(id, &ts);
+    return ts.tv_sec * 1'000'000'000ll + ts.tv_nsec;
+}
+#endif
+
+static void report_read_cost(const Source& source, std::int64_t reads) {
+    std::int64_t violations{0}, sink{0};
+    auto last = source.read();
+    auto begin = steady_nanos();
+    for (std::int64_t i = 0; i < reads; ++i) {
+	auto value = source.read();
+	violations += value < last;
+	sink += value;
+	last = value;
+    }
+    auto end = steady_nanos();
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+    fmt::print("{:<24} {:>10.1f} {:>12}", source.name, double(end - begin) / reads, violations);
+    (void)sink;
+}
+
+static void report_staleness(const Source& source, std::int64_t reads) {
+    LatencyHistogram histogram{seconds{1}};
+    for (std::int64_t i = 0; i < reads; ++i) {
+	auto value = source.read();
+	auto reference = source.reference();
+	histogram.record(reference - value);
+    }
+    fmt::print(" {:>10} {:>10} {:>10}", histogram.percentile(50).count(),
+	       histogram.percentile(99).count(), histogram.max().count());
+}
+
+static void report_jitter(const Source& source, millis duration) {
+    if (source.lowres == nullptr) {
+	fmt::print(" {:>10} {:>10} {:>10}\n", "-", "-", "-");
+	return;
+    }
+
+    // Spin watching for ticks and record how late each tick was observed relative to the
+    // instant it represents.
+    LatencyHistogram histogram{seconds{1}};
+    auto end = steady_nanos() + duration.count() * 1'000'000;
+    auto last = source.lowres->now();
+    while (steady_nanos() < end) {
+	auto now = source.lowres->now();
+	if (now != last) {
+	    histogram.record(system_nanos() - now.time_since_epoch().count());
+	    last = now;
+	}
+    }
+    fmt::print(" {:>10} {:>10} {:>10}\n", histogram.percentile(50).count(),
+	       histogram.percentile(99).count(), histogram.max().count());
+}
+
+int main(int argc, char *argv[]) {
+    int load{0};
+    std::int64_t reads{10'000'000};
+    millis duration{1000};
+    for (int i = 1; i + 1 < argc; i += 2) {
+	std::string arg{argv[i]};
+	if (arg == "--load") load = std::stoi(argv[i + 1]);
+	else if (arg == "--reads") reads = std::stoll(argv[i + 1]);
+	else if (arg == "--millis") duration = millis{std::stoll(argv[i + 1])};
+	else {
+	    std::cerr << "usage: " << argv[0] << " [--load N] [--reads N] [--millis N]"
+		      << std::endl;
+	    return 1;
+	}
+    }
+
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < load; ++i)
+	threads.emplace_back([&]() {
+	    volatile std::uint64_t counter{0};
+	    while (not done.load(std::memory_order_relaxed))
+		counter = counter + 1;
+	});
+
+    TscClock tsc;
+    LowResClock lowres_100us{LowResClock::Mode::RealTime, micros{100}};
+    LowResClock lowres_1ms{LowResClock::Mode::RealTime, millis{1}};
+    LowResClock lowres_10ms{LowResClock::Mode::RealTime, millis{10}};
+
+    auto lowres_source = [](std::string name, const LowResClock& clock) {
+	return Source{name,
+		      [&clock]() { return clock.now().time_since_epoch().count(); },
+		      system_nanos, &clock};
+    };
+
+    std::vector<Source> sources = {
+	{"system_clock", system_nanos, system_nanos},
+	{"steady_clock", steady_nanos, steady_nanos},
+#ifdef CLOCK_REALTIME_COARSE
+	{"realtime_coarse", []() { return posix_nanos(CLOCK_REALTIME_COARSE); }, system_nanos},
+	{"monotonic_coarse", []() { return posix_nanos(CLOCK_MONOTONIC_COARSE); }, steady_nanos},
+#endif
+	{"tsc", [&tsc]() { return tsc.now().time_since_epoch().count(); }, system_nanos},
+	lowres_source("lowres_100us", lowres_100us),
+	lowres_source("lowres_1ms", lowres_1ms),
+	lowres_source("lowres_10ms", lowres_10ms)
+    };
+
+    fmt::print("load threads: {}  reads: {}  jitter window: {}ms\n", load, reads,
+	       duration.count());
+    fmt::print("{:<24} {:>10} {:>12} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10}\n",
+	       "source", "read ns", "violations", "stale p50", "stale p99", "stale max",
+	       "tick p50", "tick p99", "tick max");
+    for (const auto& source : sources) {
+	report_read_cost(source, reads);
+	report_staleness(source, reads / 10);
+	report_jitter(source, duration);
+    }
+
+    done = true;
+    for (auto& thread : threads)
+	thread.join();
+    return 0;
+}
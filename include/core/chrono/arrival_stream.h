@@ -0,0 +1,190 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+#include "core/chrono/business_calendar.h"
+#include "core/chrono/counter_rng.h"
+#include "core/chrono/date.h"
+#include "core/chrono/timepoint.h"
+#include "coro/stream/sampler.h"
+
+namespace core::chrono {
+
+// The **ArrivalProcess** class is the base for generators of sorted arrival times that
+// look like production traffic rather than uniformly random instants. Like the
+// **Sampler**s, calling a process with a `start` time and a `seed` returns an endless
+// **Generator**, while `fill` writes arrivals into a span without resuming a coroutine per
+// value. Both draw from a **CounterRng**, so for a given start and seed they produce the
+// same sequence, and a **State** can be carried across calls to `fill` to continue it.
+template<class Derived>
+class ArrivalProcess {
+public:
+    // The position of a generator in its sequence.
+    struct State {
+	TimePoint time;
+	CounterRng rng;
+	std::uint64_t index{0};
+	double intensity{0};
+	double rate{0};
+	TimePoint segment_end{std::numeric_limits<std::int64_t>::min()};
+    };
+
+    // Return the initial state for arrivals after `start` using `seed`.
+    State begin(const TimePoint& start, std::uint64_t seed) const {
+	return State{start, CounterRng{seed}};
+    }
+
+    // Return the endless sequence of arrivals after `start` using `seed`.
+    coro::Generator<TimePoint> operator()(const TimePoint& start, std::uint64_t seed) const {
+	return generate(derived(), start, seed);
+    }
+
+    // Fill `out` with the first arrivals after `start` using `seed`.
+    void fill(std::span<TimePoint> out, const TimePoint& start, std::uint64_t seed) const {
+	auto state = derived().begin(start, seed);
+	fill(out, state);
+    }
+
+    // Fill `out` with the next arrivals continuing from `state`.
+    void fill(std::span<TimePoint> out, State& state) const {
+	for (auto& tp : out)
+	    tp = derived().next(state);
+    }
+
+protected:
+    // Return the exponentially distributed variate with unit mean at the next index of
+    // `state`.
+    static double exponential(State& state) {
+	return -std::log1p(-state.rng.uniform(state.index++));
+    }
+
+    // Advance `state` until the integral of the piecewise-constant intensity reaches
+    // `exposure` and return the resulting time. The `segment` function returns the rate
+    // per second in effect at a given time together with the end of that segment, which
+    // must be after the given time.
+    template<class F>
+    static TimePoint walk(State& state, double exposure, F&& segment) {
+	while (true) {
+	    if (state.time >= state.segment_end) {
+		auto [rate, end] = segment(state.time);
+		state.rate = rate;
+		state.segment_end = end;
+	    }
+	    auto seconds = 1e-9 * (state.segment_end - state.time).count();
+	    auto available = state.rate * seconds;
+	    if (available > exposure) {
+		state.time += nanos{std::int64_t(1e9 * exposure / state.rate)};
+		return state.time;
+	    }
+	    exposure -= available;
+	    state.time = state.segment_end;
+	}
+    }
+
+private:
+    const Derived& derived() const { return static_cast<const Derived&>(*this); }
+
+    static coro::Generator<TimePoint> generate(Derived process, TimePoint start,
+					       std::uint64_t seed) {
+	auto state = process.begin(start, seed);
+	while (true)
+	    co_yield process.next(state);
+    }
+};
+
+// The **PoissonArrivals** class generates arrivals at a constant `rate` per second.
+class PoissonArrivals : public ArrivalProcess<PoissonArrivals> {
+public:
+    explicit PoissonArrivals(double rate);
+
+    TimePoint next(State& state) const {
+	state.time += nanos{std::int64_t(scale_ * exponential(state))};
+	return state.time;
+    }
+
+private:
+    double scale_;
+};
+
+// The **HawkesArrivals** class generates bursty, self-exciting arrivals: each arrival
+// raises the intensity by `branching / decay`, which then decays exponentially back to the
+// `base_rate` per second with time constant `decay`. The `branching` ratio is the
+// expected number of arrivals directly triggered by each arrival and must be less than
+// one, giving a long-run rate of `base_rate / (1 - branching)`. Arrivals are simulated
+// exactly (Dassios and Zhao) using two random draws each.
+class HawkesArrivals : public ArrivalProcess<HawkesArrivals> {
+public:
+    HawkesArrivals(double base_rate, double branching, nanos decay);
+
+    State begin(const TimePoint& start, std::uint64_t seed) const {
+	auto state = ArrivalProcess::begin(start, seed);
+	state.intensity = base_rate_;
+	return state;
+    }
+
+    TimePoint next(State& state) const;
+
+private:
+    double base_rate_, jump_, beta_;
+};
+
+// The **TimeOfDayArrivals** class generates arrivals whose rate follows an intraday
+// curve: `rates` gives the rate per second for equal-width buckets of the local wall
+// clock day in the timezone `tzname` (e.g. 24 hourly rates or 1440 per-minute rates).
+class TimeOfDayArrivals : public ArrivalProcess<TimeOfDayArrivals> {
+public:
+    TimeOfDayArrivals(std::vector<double> rates, const TimeZoneName& tzname = TimeZoneName{});
+
+    TimePoint next(State& state) const {
+	return walk(state, exponential(state), [this](const TimePoint& tp) {
+	    return segment(tp);
+	});
+    }
+
+private:
+    std::pair<double, TimePoint> segment(const TimePoint& tp) const;
+
+    std::vector<double> rates_;
+    std::int64_t width_;
+    const date::time_zone *tz_;
+};
+
+// The **SessionArrivals** class generates arrivals at a constant `rate` per second during
+// the session from `open` to `close` local time in the timezone `tzname` on business
+// days, i.e. days in the weekday `mask` (bit `n` is the weekday with C encoding `n`) other
+// than the `holidays`, and none outside of sessions.
+class SessionArrivals : public ArrivalProcess<SessionArrivals> {
+public:
+    SessionArrivals(double rate,
+		    const TimeOfDay& open,
+		    const TimeOfDay& close,
+		    const TimeZoneName& tzname = TimeZoneName{},
+		    const Dates& holidays = {},
+		    BusinessCalendar::WeekdayMask mask = BusinessCalendar::Weekdays);
+
+    TimePoint next(State& state) const {
+	return walk(state, exponential(state), [this](const TimePoint& tp) {
+	    return segment(tp);
+	});
+    }
+
+    // Return true if `date` is a business day.
+    bool is_business_day(const Date& date) const;
+
+private:
+    std::pair<double, TimePoint> segment(const TimePoint& tp) const;
+
+    double rate_;
+    nanos open_, close_;
+    const date::time_zone *tz_;
+    Dates holidays_;
+    BusinessCalendar::WeekdayMask mask_;
+};
+
+}; // core::chrono
@@ -0,0 +1,32 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+#include "core/chrono/timepoint.h"
+
+namespace core::chrono {
+
+// An as-of match of element `first` of the left series with element `second` of the
+// right series.
+using AsofPair = std::pair<std::size_t, std::size_t>;
+
+// Return the as-of join of the sorted series `left` and `right`: for each element of
+// `left`, the index of the latest element of `right` at or before it (the last such
+// element when `right` contains duplicates). Elements of `left` with no such element, or
+// whose match is more than `tolerance` before them, are omitted, so the result is
+// ordered by left index.
+//
+// The join walks both series together, galloping (exponential then binary search) over
+// `right` so that a dense `right` costs O(log gap) per left element rather than O(gap).
+// When `threads` is greater than one, `left` is split into contiguous time ranges that
+// are joined concurrently, each starting from a binary search of `right`.
+std::vector<AsofPair> asof_join(std::span<const TimePoint> left,
+				std::span<const TimePoint> right,
+				nanos tolerance = nanos::max(),
+				unsigned threads = 1);
+
+}; // core::chrono
@@ -0,0 +1,108 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <vector>
+#include "core/chrono/date.h"
+
+namespace core::chrono {
+
+// The **BusinessCalendar** class represents the business days for a contiguous range of
+// years. Business days are stored as a bitmap indexed by day together with a prefix-sum
+// rank table and a select table so that testing a day, counting the business days between
+// two dates and adding business days to a date are all constant time regardless of the
+// span. Calendars covering the same years can be combined with set operations.
+class BusinessCalendar {
+public:
+    // A set of days of the week where bit `n` corresponds to the weekday with C encoding
+    // `n` (0 is Sunday).
+    using WeekdayMask = std::uint8_t;
+    static constexpr WeekdayMask Weekdays = 0b0111110;
+
+    // Construct a calendar for the years `first_year` through `last_year` inclusive where
+    // the business days are the days in `mask` other than the `holidays`.
+    BusinessCalendar(int first_year,
+		     int last_year,
+		     const Dates& holidays = {},
+		     WeekdayMask mask = Weekdays);
+
+    // Return the first day covered by the calendar.
+    Date first() const;
+
+    // Return the last day covered by the calendar.
+    Date last() const;
+
+    // Return true if `date` is covered by the calendar.
+    bool contains(const Date& date) const {
+	auto n = offset(date);
+	return n >= 0 and n < size_;
+    }
+
+    // Return true if `date` is a business day.
+    bool is_business_day(const Date& date) const {
+	auto n = checked_offset(date);
+	return test(n);
+    }
+
+    // Return the number of business days in the half-open interval [`begin`, `end`). The
+    // result is negative if `end` is before `begin`. Either bound may be the day after
+    // the last day covered.
+    std::int64_t business_days_between(const Date& begin, const Date& end) const {
+	return rank(checked_bound(end)) - rank(checked_bound(begin));
+    }
+
+    // Return the `n`th business day after `date` for positive `n` or before `date` for
+    // negative `n`. For zero `n`, return `date` if it is a business day and otherwise the
+    // next business day.
+    Date add_business_days(const Date& date, std::int64_t n) const;
+
+    // Return the number of business days in the calendar.
+    std::size_t count() const { return select_.size(); }
+
+    // Return the calendar whose business days are business days in both calendars.
+    BusinessCalendar operator&(const BusinessCalendar& other) const;
+
+    // Return the calendar whose business days are business days in either calendar.
+    BusinessCalendar operator|(const BusinessCalendar& other) const;
+
+    bool operator==(const BusinessCalendar& other) const {
+	return first_ == other.first_ and size_ == other.size_ and words_ == other.words_;
+    }
+
+private:
+    BusinessCalendar() = default;
+
+    std::int64_t offset(const Date& date) const {
+	return date::sys_days{date}.time_since_epoch().count() - first_;
+    }
+
+    std::int64_t checked_offset(const Date& date) const;
+
+    // Return the offset of `date` as an interval bound, which may also be `size_`.
+    std::int64_t checked_bound(const Date& date) const;
+
+    bool test(std::int64_t n) const {
+	return (words_[n >> 6] >> (n & 63)) & 1;
+    }
+
+    // Return the number of business days before offset `n`, where `n` may be `size_`
+    // since the bitmap always has a word for that offset.
+    std::int64_t rank(std::int64_t n) const {
+	auto bits = words_[n >> 6] & ((std::uint64_t{1} << (n & 63)) - 1);
+	return rank_[n >> 6] + std::popcount(bits);
+    }
+
+    // Rebuild the rank and select tables from the bitmap.
+    void index();
+
+    Date at(std::int64_t n) const;
+
+    std::int64_t first_{0}, size_{0};
+    std::vector<std::uint64_t> words_;
+    std::vector<std::uint32_t> rank_;
+    std::vector<std::uint32_t> select_;
+};
+
+}; // core::chrono
@@ -0,0 +1,82 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include "core/chrono/periodically.h"
+
+namespace chron
+{
+
+// The **BasicConcurrentPeriodically** class is a thread-safe **Periodically** that can be
+// shared between threads. The next deadline is held in a single atomic and advanced with a
+// compare-and-swap, so exactly one caller returns true per period no matter how many
+// threads are calling concurrently.
+template<TimeSource Source>
+class BasicConcurrentPeriodically {
+public:
+    template<class Duration>
+    BasicConcurrentPeriodically(const Duration& period, Source source = Source{})
+	: period_(std::chrono::duration_cast<chron::nanos>(period).count())
+	, source_(source)
+    { }
+
+    bool operator()() {
+	std::int64_t now = source_.now().time_since_epoch().count();
+	std::int64_t next = next_.load(std::memory_order_relaxed);
+	if (now < next)
+	    return false;
+	return next_.compare_exchange_strong(next, now + period_, std::memory_order_relaxed);
+    }
+
+private:
+    alignas(64) std::atomic<std::int64_t> next_{0};
+    std::int64_t period_;
+    Source source_;
+};
+
+using ConcurrentPeriodically = BasicConcurrentPeriodically<SystemTimeSource>;
+
+// The **BasicTokenBucket** class is a thread-safe rate gate that returns true at most
+// `count` times per period, allowing bursts of up to `count`. It is implemented as a
+// generic cell rate algorithm: the bucket state is a single theoretical arrival time that
+// is advanced with a compare-and-swap. The `count` must be positive and no more than the
+// number of nanoseconds in the period.
+template<TimeSource Source>
+class BasicTokenBucket {
+public:
+    template<class Duration>
+    BasicTokenBucket(std::int64_t count, const Duration& period, Source source = Source{})
+	: interval_(count > 0 ? std::chrono::duration_cast<chron::nanos>(period).count() / count : 0)
+	, tolerance_(std::chrono::duration_cast<chron::nanos>(period).count() - interval_)
+	, source_(source) {
+	if (count <= 0)
+	    throw core::runtime_error("TokenBucket: count must be positive: {}", count);
+	if (interval_ <= 0)
+	    throw core::runtime_error("TokenBucket: period of {}ns is too short for {} tokens",
+				      interval_ + tolerance_, count);
+    }
+
+    bool operator()() {
+	std::int64_t now = source_.now().time_since_epoch().count();
+	std::int64_t tat = tat_.load(std::memory_order_relaxed);
+	while (true) {
+	    if (now < tat - tolerance_)
+		return false;
+	    auto next = std::max(tat, now) + interval_;
+	    if (tat_.compare_exchange_weak(tat, next, std::memory_order_relaxed))
+		return true;
+	}
+    }
+
+private:
+    alignas(64) std::atomic<std::int64_t> tat_{0};
+    std::int64_t interval_;
+    std::int64_t tolerance_;
+    Source source_;
+};
+
+using TokenBucket = BasicTokenBucket<SystemTimeSource>;
+
+}; // chron
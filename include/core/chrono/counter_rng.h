@@ -0,0 +1,53 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <cstdint>
+#include "core/chrono/hash.h"
+
+namespace core::chrono {
+
+// The **CounterRng** class is a counter-based random number generator: the `i`th value
+// of the stream for a given seed is a pure function of the seed and `i` (the `i`th output
+// of a splitmix64 stream, which supports jumping ahead in constant time). There is no
+// state carried between values, so a span can be filled by independent iterations that
+// the compiler can unroll and interleave, and any partition of the index range across
+// threads produces exactly the same values.
+class CounterRng {
+public:
+    constexpr explicit CounterRng(std::uint64_t seed)
+	: seed_(detail::mix64(seed)) {
+    }
+
+    // Return the 64 random bits at `index`.
+    constexpr std::uint64_t bits(std::uint64_t index) const {
+	return detail::mix64(seed_ + (index + 1) * Gamma);
+    }
+
+    // Return a value in [0, `n`) at `index` using Lemire's multiply-shift reduction. A
+    // zero `n` denotes the full 64-bit range. The bias is at most `n / 2^64`.
+    constexpr std::uint64_t below(std::uint64_t index, std::uint64_t n) const {
+	auto x = bits(index);
+	if (n == 0)
+	    return x;
+	return std::uint64_t((static_cast<unsigned __int128>(x) * n) >> 64);
+    }
+
+    // Return a value in [`lo`, `hi`] at `index`.
+    constexpr std::int64_t between(std::uint64_t index, std::int64_t lo, std::int64_t hi) const {
+	auto n = std::uint64_t(hi) - std::uint64_t(lo) + 1;
+	return std::int64_t(std::uint64_t(lo) + below(index, n));
+    }
+
+    // Return a real value in [0, 1) at `index`.
+    constexpr double uniform(std::uint64_t index) const {
+	return (bits(index) >> 11) * 0x1.0p-53;
+    }
+
+private:
+    static constexpr std::uint64_t Gamma = 0x9e3779b97f4a7c15;
+
+    std::uint64_t seed_;
+};
+
+}; // core::chrono
@@ -4,8 +4,13 @@
 #pragma once
 #include <chrono>
 #include <compare>
+#include <functional>
+#include <string>
+#include <string_view>
 #include <fmt/format.h>
 #include <date/tz.h>
+#include "core/chrono/hash.h"
+#include "core/util/json.h"
 #include "core/util/phantom.h"
 
 namespace core::chrono {
@@ -35,6 +40,47 @@ struct TimeZoneName : public Phantom<std::string> {
     TimeZoneName(const std::string& name = "UTC")
 	: Phantom<std::string>(name) {
     }
+
+    // Return true if this names UTC.
+    bool is_utc() const { return static_cast<const std::string&>(*this) == "UTC"; }
+};
+
+// The **Utc** tag selects UTC as the timezone of a conversion at compile time. Conversions
+// given **Utc** are integer arithmetic and never consult the timezone database.
+struct Utc {};
+
+// The **FixedOffset** class is a timezone with a constant offset from UTC and no daylight
+// saving time, e.g. `+05:30`. Like **Utc** (which converts to a zero offset), conversions
+// given a **FixedOffset** are integer arithmetic.
+class FixedOffset {
+public:
+    constexpr FixedOffset(Utc = Utc{}) {
+    }
+
+    // Construct the **FixedOffset** that is `offset` ahead of UTC.
+    constexpr explicit FixedOffset(std::chrono::minutes offset)
+	: offset_(offset) {
+	if (offset_ <= -std::chrono::hours{24} or offset_ >= std::chrono::hours{24})
+	    throw core::runtime_error("FixedOffset: offset must be less than a day: {}min",
+				      offset_.count());
+    }
+
+    // Construct a **FixedOffset** from `str` of the form `[+-]HH[[:]MM]` or `Z`.
+    explicit FixedOffset(std::string_view str);
+
+    // Return the offset from UTC.
+    constexpr std::chrono::minutes offset() const { return offset_; }
+
+    // Return the offset from UTC in nanoseconds.
+    constexpr std::int64_t offset_nanos() const { return offset_.count() * 60'000'000'000; }
+
+    // Return the offset formatted as `[+-]HH:MM`.
+    std::string to_string() const;
+
+    auto operator<=>(const FixedOffset& other) const = default;
+
+private:
+    std::chrono::minutes offset_{0};
 };
 
 // The **Date** class represents a specific year, month and calendar day. Since **Date**
@@ -56,10 +102,14 @@ public:
     static const date::time_zone *locate_timezone(const std::string& tzname);
 
     // Return the earliest representable **Date**.
-    static Date min();
-     
-   // Return the latest representable **Date**.
-    static Date max();
+    static constexpr Date min() {
+	return Date{date::year::min(), date::month{1}, date::day{1}};
+    }
+
+    // Return the latest representable **Date**.
+    static constexpr Date max() {
+	return Date{date::year::max(), date::month{12}, date::day{31}};
+    }
 
     // Construct a **Date** from the base class.
     constexpr Date(const DateBase& base)
@@ -76,7 +126,11 @@ public:
 
     // Construct the **Date** corresponding to the **TimePoint** `tp` for the timezone
     // `tzname`.
-    explicit Date(const TimePoint& tp, const TimeZoneName& tzname = TimeZoneName{});
+    explicit Date(const TimePoint& tp, const TimeZoneName& tzname);
+
+    // Construct the **Date** corresponding to the **TimePoint** `tp` in UTC or at the
+    // fixed `offset` from UTC.
+    constexpr explicit Date(const TimePoint& tp, FixedOffset offset = Utc{});
 
     // Construct the **Date** corresponding to `nanos` nanoseconds after the epoch for the
     // timezone `tzname`.
@@ -95,37 +149,54 @@ public:
 
     // Return the **TimePoint** corresponding to midnight for this **Date** in the given
     // timezone `tzname`.
-    TimePoint to_timepoint(const TimeZoneName& tzname = TimeZoneName{});
+    TimePoint to_timepoint(const TimeZoneName& tzname) const;
+
+    // Return the **TimePoint** corresponding to midnight for this **Date** in UTC or at
+    // the fixed `offset` from UTC.
+    constexpr TimePoint to_timepoint(FixedOffset offset = Utc{}) const;
 
     // Return the unix timestamp as the real-valued seconds since the epoch.
-    double unix_ts() const;
+    constexpr double unix_ts() const {
+	return 86'400.0 * date::sys_days{*this}.time_since_epoch().count();
+    }
 
     // Return the **Date** for tomorrow.
-    Date tomorrow() const;
+    constexpr Date tomorrow() const { return *this + std::chrono::days{1}; }
 
     // Return the **Date** for yesterday.
-    Date yesterday() const;
+    constexpr Date yesterday() const { return *this - std::chrono::days{1}; }
 
     // Advance date by one day.
-    Date& operator++();
+    constexpr Date& operator++() { return *this += std::chrono::days{1}; }
 
     // Move date backwards by one day.
-    Date& operator--();
+    constexpr Date& operator--() { return *this += std::chrono::days{-1}; }
 
     // Add `n` days to this **Date**
-    Date& operator+=(std::chrono::days n);
-    
+    constexpr Date& operator+=(std::chrono::days n) {
+	*this = Date{date::year_month_day{date::sys_days{*this} + n}};
+	return *this;
+    }
+
     // Return a **Date** representing `n` days after this **Date**.
-    Date operator+(std::chrono::days n) const;
-    
+    constexpr Date operator+(std::chrono::days n) const {
+	Date date{*this};
+	return date += n;
+    }
+
     // Subtract `n` days from this **Date**
-    Date& operator-=(std::chrono::days n);
+    constexpr Date& operator-=(std::chrono::days n) { return *this += -n; }
 
     // Return a **Date** representing `n` days before this **Date**.
-    Date operator-(std::chrono::days n) const;
+    constexpr Date operator-(std::chrono::days n) const {
+	Date date{*this};
+	return date -= n;
+    }
 
     // Return the duration between **Date** and the `other` **Date**.
-    std::chrono::days operator-(Date other) const;
+    constexpr std::chrono::days operator-(Date other) const {
+	return date::sys_days{*this} - date::sys_days{other};
+    }
 
 private:
     DateBase *base() { return this; }
@@ -148,6 +219,13 @@ template<> struct lexical_cast_impl<core::chrono::Date> {
 
 std::ostream& operator<<(std::ostream& os, const std::chrono::year_month_day& ymd);
 
+template<>
+struct std::hash<core::chrono::Date> {
+    std::size_t operator()(const core::chrono::Date& date) const noexcept {
+	return core::chrono::detail::mix64(date::sys_days{date}.time_since_epoch().count());
+    }
+};
+
 namespace chron {
 using namespace core::chrono;
 using namespace core::chrono::literals;
@@ -0,0 +1,135 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "core/chrono/date.h"
+
+namespace core::chrono {
+
+// The **DateIndexed** class holds one `T` for each day from `first` through `last`
+// inclusive in a contiguous array indexed by the day serial (days since the epoch) less
+// the serial of `first`. Lookup is a subtraction and a bounds check with no hashing or
+// tree traversal, and iterating the values visits the days in order. It is the natural
+// replacement for `std::map<Date,T>` when the dates are dense over a known span, such as
+// daily series or per-day caches.
+template<class T>
+class DateIndexed {
+public:
+    using value_type = T;
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    // Construct an empty container.
+    DateIndexed() = default;
+
+    // Construct a container for the days `first` through `last` inclusive with each
+    // value initialized to `value`.
+    DateIndexed(const Date& first, const Date& last, const T& value = T{})
+	: first_(serial(first)) {
+	if (last < first)
+	    throw core::runtime_error("DateIndexed: last {} is before first {}", last, first);
+	values_.assign(serial(last) - first_ + 1, value);
+    }
+
+    // Return the first day covered, which requires that the container is not empty.
+    Date first() const { return at_serial(first_); }
+
+    // Return the last day covered, which requires that the container is not empty.
+    Date last() const { return at_serial(first_ + std::int64_t(values_.size()) - 1); }
+
+    // Return the number of days covered.
+    std::size_t size() const { return values_.size(); }
+
+    // Return true if no days are covered.
+    bool empty() const { return values_.empty(); }
+
+    // Return true if `date` is covered.
+    bool contains(const Date& date) const {
+	return std::uint64_t(offset(date)) < values_.size();
+    }
+
+    // Return the value for `date`, which must be covered.
+    T& operator[](const Date& date) { return values_[offset(date)]; }
+    const T& operator[](const Date& date) const { return values_[offset(date)]; }
+
+    // Return the value for `date`. Throw if `date` is not covered.
+    T& at(const Date& date) { return values_[checked_offset(date)]; }
+    const T& at(const Date& date) const { return values_[checked_offset(date)]; }
+
+    // Return a pointer to the value for `date` or nullptr if `date` is not covered.
+    T *find(const Date& date) {
+	return contains(date) ? &values_[offset(date)] : nullptr;
+    }
+    const T *find(const Date& date) const {
+	return contains(date) ? &values_[offset(date)] : nullptr;
+    }
+
+    // Return the day for the value at `index`.
+    Date date(std::size_t index) const { return at_serial(first_ + std::int64_t(index)); }
+
+    // Extend the days covered to include `date`, initializing any new days to `value`.
+    // Existing values keep their days but references to them are invalidated.
+    void extend(const Date& date, const T& value = T{}) {
+	if (empty()) {
+	    first_ = serial(date);
+	    values_.assign(1, value);
+	    return;
+	}
+	auto n = offset(date);
+	if (n < 0) {
+	    values_.insert(values_.begin(), -n, value);
+	    first_ += n;
+	} else if (n >= std::int64_t(values_.size())) {
+	    values_.resize(n + 1, value);
+	}
+    }
+
+    // Invoke `func` with each covered day and its value in order.
+    template<class F>
+    void for_each(F&& func) {
+	for (std::size_t i = 0; i < values_.size(); ++i)
+	    func(date(i), values_[i]);
+    }
+    template<class F>
+    void for_each(F&& func) const {
+	for (std::size_t i = 0; i < values_.size(); ++i)
+	    func(date(i), values_[i]);
+    }
+
+    // Return the values in order of their days.
+    T *data() { return values_.data(); }
+    const T *data() const { return values_.data(); }
+    iterator begin() { return values_.begin(); }
+    iterator end() { return values_.end(); }
+    const_iterator begin() const { return values_.begin(); }
+    const_iterator end() const { return values_.end(); }
+
+    bool operator==(const DateIndexed& other) const = default;
+
+private:
+    static std::int64_t serial(const Date& date) {
+	return date::sys_days{date}.time_since_epoch().count();
+    }
+
+    static Date at_serial(std::int64_t serial) {
+	return Date{date::sys_days{date::days{serial}}};
+    }
+
+    std::int64_t offset(const Date& date) const {
+	return serial(date) - first_;
+    }
+
+    std::int64_t checked_offset(const Date& date) const {
+	auto n = offset(date);
+	if (std::uint64_t(n) >= values_.size())
+	    throw core::runtime_error("DateIndexed: {} is outside the covered days", date);
+	return n;
+    }
+
+    std::int64_t first_{0};
+    std::vector<T> values_;
+};
+
+}; // core::chrono
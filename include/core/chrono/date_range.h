@@ -0,0 +1,124 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <ranges>
+#include "core/chrono/date.h"
+
+namespace core::chrono {
+
+// The **DateRange** class is a view of the dates from `begin` (inclusive) to `end`
+// (exclusive) advancing by a fixed number of days, weeks or months. Unlike **Date** acting
+// as its own forward iterator, the **DateRange** iterators are random-access with a signed
+// `difference_type`, so `std::distance`, indexing and splitting the range (e.g. for
+// parallel algorithms) are all constant time. When stepping by months, days past the end
+// of a shorter month are clamped to the last day of that month.
+class DateRange : public std::ranges::view_interface<DateRange> {
+public:
+    enum class Step : std::uint8_t { Days, Weeks, Months };
+
+    class iterator {
+    public:
+	// The iterators compute their dates, so `reference` is the prvalue `Date` and they
+	// are not strictly C++17 forward iterators. Unlike `std::ranges::iota_view`, which
+	// reports `input_iterator_tag` for that reason, the category is deliberately
+	// random-access so that the `std::execution` algorithms, which only dereference,
+	// copy and advance the iterators, split the range by index instead of walking it.
+	using iterator_concept = std::random_access_iterator_tag;
+	using iterator_category = std::random_access_iterator_tag;
+	using value_type = Date;
+	using difference_type = std::ptrdiff_t;
+	using reference = Date;
+
+	iterator() = default;
+
+	Date operator*() const { return at(index_); }
+	Date operator[](difference_type n) const { return at(index_ + n); }
+
+	iterator& operator++() { ++index_; return *this; }
+	iterator operator++(int) { auto tmp = *this; ++index_; return tmp; }
+	iterator& operator--() { --index_; return *this; }
+	iterator operator--(int) { auto tmp = *this; --index_; return tmp; }
+	iterator& operator+=(difference_type n) { index_ += n; return *this; }
+	iterator& operator-=(difference_type n) { index_ -= n; return *this; }
+
+	friend iterator operator+(iterator it, difference_type n) { return it += n; }
+	friend iterator operator+(difference_type n, iterator it) { return it += n; }
+	friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+	friend difference_type operator-(const iterator& a, const iterator& b) {
+	    return a.index_ - b.index_;
+	}
+
+	bool operator==(const iterator& other) const { return index_ == other.index_; }
+	auto operator<=>(const iterator& other) const { return index_ <=> other.index_; }
+
+    private:
+	friend class DateRange;
+
+	iterator(std::int32_t origin, std::int32_t stride, Step step, difference_type index)
+	    : origin_(origin)
+	    , stride_(stride)
+	    , step_(step)
+	    , index_(index)
+	{ }
+
+	Date at(difference_type n) const {
+	    if (step_ != Step::Months)
+		return Date{date::sys_days{date::days{origin_ + n * stride_}}};
+
+	    Date origin{date::sys_days{date::days{origin_}}};
+	    auto ym = date::year_month{origin.year(), origin.month()} + date::months{n * stride_};
+	    auto last = date::year_month_day_last{ym.year(), date::month_day_last{ym.month()}};
+	    auto day = std::min(unsigned(origin.day()), unsigned(last.day()));
+	    return Date{int(ym.year()), unsigned(ym.month()), day};
+	}
+
+	std::int32_t origin_{0};
+	std::int32_t stride_{1};
+	Step step_{Step::Days};
+	difference_type index_{0};
+    };
+
+    DateRange() = default;
+
+    // Construct the range of dates from `begin` up to but excluding `end` advancing by
+    // `stride` units of `step`.
+    DateRange(const Date& begin, const Date& end, Step step = Step::Days, int stride = 1);
+
+    // Return the range of every `stride`'th day from `begin` up to but excluding `end`.
+    static DateRange daily(const Date& begin, const Date& end, int stride = 1) {
+	return DateRange{begin, end, Step::Days, stride};
+    }
+
+    // Return the range of every `stride`'th week from `begin` up to but excluding `end`.
+    static DateRange weekly(const Date& begin, const Date& end, int stride = 1) {
+	return DateRange{begin, end, Step::Weeks, stride};
+    }
+
+    // Return the range of every `stride`'th month from `begin` up to but excluding `end`.
+    static DateRange monthly(const Date& begin, const Date& end, int stride = 1) {
+	return DateRange{begin, end, Step::Months, stride};
+    }
+
+    iterator begin() const { return iterator{origin_, stride_, step_, 0}; }
+    iterator end() const { return iterator{origin_, stride_, step_, size_}; }
+    std::size_t size() const { return size_; }
+
+private:
+    std::int32_t origin_{0};
+    std::int32_t stride_{1};
+    Step step_{Step::Days};
+    std::ptrdiff_t size_{0};
+};
+
+}; // core::chrono
+
+template<>
+inline constexpr bool std::ranges::enable_borrowed_range<core::chrono::DateRange> = true;
+
+namespace chron {
+using namespace core::chrono;
+};
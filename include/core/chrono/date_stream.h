@@ -2,7 +2,9 @@
 //
 
 #pragma once
+#include <span>
 #include "core/util/random.h"
+#include "core/chrono/counter_rng.h"
 #include "core/chrono/date.h"
 #include "coro/stream/sampler.h"
 
@@ -13,6 +15,16 @@ struct Sampler<core::chrono::Date> {
     Generator<chron::Date> operator()
     (chron::Date start = chron::jan/1/1990,
      chron::Date end = chron::jan/1/2040) const;
+
+    // Fill `out` with dates uniformly distributed in [`start`, `end`] where element `i`
+    // is the value at position `index + i` of the counter-based stream for `seed`. The
+    // output depends only on the seed and positions, so a large span can be filled by
+    // threads filling disjoint subspans with the corresponding `index`.
+    static void fill(std::span<chron::Date> out,
+		     chron::Date start,
+		     chron::Date end,
+		     std::uint64_t seed,
+		     std::uint64_t index = 0);
 };
 
 }; // coro
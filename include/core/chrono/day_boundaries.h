@@ -0,0 +1,83 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include "core/chrono/date.h"
+
+namespace core::chrono {
+
+// The **DayBoundaries** class is a lazily filled table of the instants at which each day
+// starts in a given timezone, keyed by the day serial (days since the epoch). With the
+// table, converting a **TimePoint** to a **Date**, the time of day, midnight or the next
+// midnight is a table lookup and a subtraction rather than a pair of timezone
+// conversions. Days containing a DST transition are 23 or 25 hours long and simply have
+// start instants that are closer together or further apart. When midnight does not exist
+// (i.e. a transition skips it) the day starts at the transition; when it occurs twice the
+// day starts at the earlier occurrence.
+//
+// The table covers the days from 1800 through 2299 in chunks that are filled on first use
+// and shared by all threads. Days outside that span are computed on every call. The table
+// reflects the timezone database at the time the chunk is filled.
+class DayBoundaries {
+public:
+    // Return the table for the timezone `tzname`. Tables are created on first use and
+    // live for the duration of the process.
+    static const DayBoundaries& of(const TimeZoneName& tzname);
+
+    explicit DayBoundaries(const date::time_zone *tz);
+    ~DayBoundaries();
+
+    DayBoundaries(const DayBoundaries&) = delete;
+    DayBoundaries& operator=(const DayBoundaries&) = delete;
+
+    // Return the timezone for this table.
+    const date::time_zone *zone() const { return tz_; }
+
+    // Return the start of day `serial` as nanoseconds since the epoch.
+    std::int64_t start(std::int64_t serial) const {
+	auto n = serial - FirstSerial;
+	if (n < 0 or n >= NumberChunks * ChunkSize)
+	    return compute(serial);
+	auto chunk = chunks_[n / ChunkSize].load(std::memory_order_acquire);
+	if (chunk == nullptr)
+	    chunk = fill(n / ChunkSize);
+	return chunk[n % ChunkSize];
+    }
+
+    // Return the serial of the day containing the instant `nanos` since the epoch.
+    std::int64_t serial(std::int64_t nanos) const {
+	// Offsets from UTC are less than a day, so the local day is within one day of the
+	// UTC day.
+	auto day = floor_div(nanos, NanosPerDay);
+	if (nanos < start(day))
+	    return day - 1;
+	if (nanos >= start(day + 1))
+	    return day + 1;
+	return day;
+    }
+
+private:
+    static constexpr std::int64_t NanosPerDay = 86'400'000'000'000;
+    static constexpr std::int64_t ChunkSize = 512;
+    static constexpr std::int64_t FirstSerial = -62'091; // 1800-01-01
+    static constexpr std::int64_t LastSerial = 120'529; // 2299-12-31
+    static constexpr std::int64_t NumberChunks =
+	(LastSerial - FirstSerial + ChunkSize) / ChunkSize;
+
+    static constexpr std::int64_t floor_div(std::int64_t a, std::int64_t b) {
+	auto q = a / b;
+	return q - ((a % b) < 0);
+    }
+
+    std::int64_t compute(std::int64_t serial) const;
+    const std::int64_t *fill(std::int64_t index) const;
+
+    const date::time_zone *tz_;
+    mutable std::array<std::atomic<const std::int64_t*>, NumberChunks> chunks_{};
+};
+
+}; // core::chrono
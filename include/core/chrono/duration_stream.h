@@ -2,7 +2,9 @@
 //
 
 #pragma once
+#include <span>
 #include "core/util/random.h"
+#include "core/chrono/counter_rng.h"
 #include "core/chrono/duration.h"
 #include "coro/stream/sampler.h"
 
@@ -22,6 +24,17 @@ struct Sampler<T> {
 	}
 	co_return;
     };
+
+    // Fill `out` with durations uniformly distributed in [`start`, `end`] where element `i`
+    // is the value at position `index + i` of the counter-based stream for `seed`. The
+    // output depends only on the seed and positions, so a large span can be filled by
+    // threads filling disjoint subspans with the corresponding `index`.
+    static void fill(std::span<T> out, T start, T end, std::uint64_t seed,
+		     std::uint64_t index = 0) {
+	core::chrono::CounterRng rng{seed};
+	for (std::size_t i = 0; i < out.size(); ++i)
+	    out[i] = T{rng.between(index + i, start.count(), end.count())};
+    }
 };
 
 }; // coro
@@ -0,0 +1,19 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <cstdint>
+
+namespace core::chrono::detail {
+
+// Return the splitmix64 finalizer of `z`, a bijection in which every input bit affects
+// every output bit. The standard library hashes integers as themselves, so keys such as
+// consecutive days or timestamps on a millisecond grid would otherwise differ only in a
+// few bits (or share their low bits) and collide in power-of-two hash tables.
+constexpr std::uint64_t mix64(std::uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+}
+
+}; // core::chrono::detail
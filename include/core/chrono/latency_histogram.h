@@ -0,0 +1,120 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <vector>
+#include "core/chrono/duration.h"
+#include "core/chrono/stopwatch.h"
+#include "core/util/json.h"
+
+namespace core::chrono {
+
+// The **LatencyHistogram** class records nanosecond latencies into log-linear buckets in
+// the style of an HDR histogram. Values below `2^precision` nanos are recorded exactly and
+// larger values with a relative error of at most `2^-precision`. All storage is allocated
+// on construction so recording is constant time and never allocates. Histograms with the
+// same configuration, typically one per thread, can be merged for reporting.
+class LatencyHistogram {
+public:
+    // Construct a histogram that records values up to `highest` with `precision` bits of
+    // sub-bucket resolution. Larger values are recorded in the highest bucket.
+    LatencyHistogram(nanos highest = hours{1}, int precision = 7);
+
+    // Record a single latency of `ns` nanoseconds.
+    void record(std::int64_t ns) {
+	auto value = static_cast<std::uint64_t>(ns < 0 ? 0 : ns);
+	++counts_[std::min(index_of(value), counts_.size() - 1)];
+	++count_;
+	sum_ += value;
+	min_ = std::min(min_, value);
+	max_ = std::max(max_, value);
+    }
+
+    // Record a single latency `duration`.
+    template<class Rep, class Period>
+    void record(std::chrono::duration<Rep,Period> duration) {
+	record(std::chrono::duration_cast<nanos>(duration).count());
+    }
+
+    // Record the interval since the last mark of the **StopWatch** `sw` and mark it.
+    template<class Clock>
+    void record(chron::StopWatch<Clock>& sw) {
+	record(sw.mark());
+    }
+
+    // Add the counts from the `other` histogram which must have the same configuration.
+    void merge(const LatencyHistogram& other);
+
+    // Clear all recorded values.
+    void reset();
+
+    // Return the number of recorded values.
+    std::uint64_t count() const { return count_; }
+
+    // Return the smallest recorded value.
+    nanos min() const { return nanos(count_ > 0 ? min_ : 0); }
+
+    // Return the largest recorded value.
+    nanos max() const { return nanos(max_); }
+
+    // Return the mean of the recorded values.
+    double mean() const { return count_ > 0 ? double(sum_) / count_ : 0.0; }
+
+    // Return the value at percentile `p` (0 to 100).
+    nanos percentile(double p) const;
+
+    // Return the sub-bucket precision in bits.
+    int precision() const { return precision_; }
+
+    // Return the highest trackable value.
+    nanos highest() const { return nanos(value_of(counts_.size()) - 1); }
+
+    // Return the number of buckets.
+    std::size_t size() const { return counts_.size(); }
+
+    // Return the count for bucket `index`.
+    std::uint64_t count_at(std::size_t index) const { return counts_[index]; }
+
+    // Return the smallest value recorded in bucket `index`.
+    std::uint64_t value_of(std::size_t index) const {
+	std::uint64_t m = std::uint64_t{1} << precision_;
+	if (index < m)
+	    return index;
+	auto shift = (index - m) >> precision_;
+	auto sub = (index - m) & (m - 1);
+	return (m + sub) << shift;
+    }
+
+    // Return the bucket index for `value`.
+    std::size_t index_of(std::uint64_t value) const {
+	std::uint64_t m = std::uint64_t{1} << precision_;
+	if (value < m)
+	    return value;
+	int shift = std::bit_width(value) - 1 - precision_;
+	return m + (std::size_t(shift) << precision_) + ((value >> shift) - m);
+    }
+
+    // Write the histogram as JSON to the file `path` if it ends in `.json`, otherwise as
+    // text.
+    void save(const std::string& path) const;
+
+private:
+    int precision_;
+    std::vector<std::uint64_t> counts_;
+    std::uint64_t count_{0}, sum_{0};
+    std::uint64_t min_{std::numeric_limits<std::uint64_t>::max()}, max_{0};
+};
+
+std::ostream& operator<<(std::ostream& os, const LatencyHistogram& histogram);
+
+void to_json(json& j, const LatencyHistogram& histogram);
+
+}; // core::chrono
+
+namespace chron {
+using namespace core::chrono;
+};
@@ -2,11 +2,18 @@
 //
 
 #pragma once
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 #include "core/chrono/chrono.h"
 
 namespace core::chrono {
 
+class DayBoundaries;
+
 // LowResClock provides very fast access to the current time with
 // configurable resolution (typically 1ms). This provides an
 // alternative to the standard system time which has high resolution
@@ -20,10 +27,65 @@ namespace core::chrono {
 // The clocks tracks real time modulo the given resolution using a
 // separate thread that is periodically awakened and updates the
 // internal time point using the high resolution system clock.
+//
+// The clock also publishes the current date and start of day for a
+// registered set of timezones. These are updated by the same thread
+// only when midnight is crossed, so asking for today's date or the
+// current time of day in a registered zone is a couple of loads
+// rather than a call to the system clock and a zone conversion. The
+// calendars follow the real time (i.e. now()), not the virtual time.
 class LowResClock {
 public:
     enum class Mode { RealTime, Virtual };
 
+    // The index of a registered zone.
+    using ZoneIndex = std::size_t;
+
+    // The maximum number of registered zones.
+    static constexpr std::size_t MaxZones = 16;
+
+    // The **Calendar** class holds the current local day for a zone. It
+    // is advanced by a single writer and read lock-free by any number of
+    // readers. Each day is kept until the calendar is destroyed so that
+    // readers never see a released day.
+    class Calendar {
+    public:
+	// Construct the calendar for the zone `tzname` starting with the
+	// day containing `now`.
+	Calendar(const TimeZoneName& tzname, TimePoint now);
+
+	// Advance to the day containing `now` if it is after the current
+	// day. Must only be called by the single writer.
+	void update(TimePoint now);
+
+	// Return the current date.
+	Date date() const { return day_.load(std::memory_order_acquire)->date; }
+
+	// Return the start of the current day.
+	TimePoint day_start() const { return day_.load(std::memory_order_acquire)->start; }
+
+	// Return the time of day at `now`, which must not be after the
+	// end of the current day.
+	TimeOfDay time_of_day(TimePoint now) const {
+	    auto day = day_.load(std::memory_order_acquire);
+	    // The day rolled over after `now` was read.
+	    if (now < day->start and day->previous != nullptr)
+		day = day->previous;
+	    return TimeOfDay{now - day->start};
+	}
+
+    private:
+	struct Day {
+	    Date date;
+	    TimePoint start, end;
+	    const Day *previous;
+	};
+
+	const DayBoundaries *table_;
+	std::atomic<const Day*> day_;
+	std::vector<std::unique_ptr<Day>> days_;
+    };
+
     // Construct a clock with the given <mode> and <resolution>.
     LowResClock(Mode mode, chron::nanos resolution);
     ~LowResClock();
@@ -50,11 +112,35 @@ public:
 	assert(mode_ == Mode::Virtual);
 	virtual_now_ = tp;
     }
+
+    // Register the timezone `tzname` and return its index. Registering
+    // the same zone again returns the same index.
+    ZoneIndex add_zone(const TimeZoneName& tzname);
+
+    // Return the calendar for the registered zone `index`.
+    const Calendar& calendar(ZoneIndex index) const { return *calendars_[index]; }
+
+    // Return the current date in the registered zone `index`.
+    Date today(ZoneIndex index) const { return calendar(index).date(); }
+
+    // Return the start of the current day in the registered zone `index`.
+    TimePoint day_start(ZoneIndex index) const { return calendar(index).day_start(); }
+
+    // Return the current time of day in the registered zone `index`.
+    TimeOfDay time_of_day(ZoneIndex index) const {
+	return calendar(index).time_of_day(now_.load(std::memory_order_acquire));
+    }
     
 private:
+    // Advance the time by one tick.
+    void tick();
+
     Mode mode_;
     chron::nanos resolution_;
     std::atomic<chron::TimePoint> now_, virtual_now_;
+    std::mutex mutex_;
+    std::array<std::unique_ptr<Calendar>, MaxZones> calendars_;
+    std::vector<const DayBoundaries*> tables_;
     std::thread thread_;
     std::atomic<bool> done_{false};
 };
@@ -2,20 +2,64 @@
 //
 
 #pragma once
+#include <concepts>
+#include <cstdint>
 #include "core/chrono/chrono.h"
 
 namespace chron
 {
 
-class Periodically {
+// A **TimeSource** is anything that can report the current **TimePoint**.
+template<class T>
+concept TimeSource = requires (const T& source) {
+    { source.now() } -> std::convertible_to<TimePoint>;
+};
+
+// The **SystemTimeSource** reads the current time from the system clock.
+struct SystemTimeSource {
+    TimePoint now() const { return TimePoint::now(); }
+};
+
+// The **ClockTimeSource** reads the current time from an externally owned clock such as
+// **LowResClock** or **TscClock**. The clock must outlive the time source.
+template<class Clock>
+class ClockTimeSource {
 public:
+    ClockTimeSource(const Clock& clock)
+	: clock_(&clock)
+    { }
+
+    TimePoint now() const { return clock_->now(); }
+
+private:
+    const Clock *clock_;
+};
+
+// The **BasicPeriodically** class returns true at most once per period. The current time
+// is read from `Source` and, when a `check_interval` greater than one is given, only on
+// every `check_interval`'th call; the calls in between return false without reading the
+// clock. The first call always reads the clock and returns true.
+template<TimeSource Source>
+class BasicPeriodically {
+public:
+    template<class Duration>
+    BasicPeriodically(const Duration& period, std::uint32_t check_interval = 1)
+	: BasicPeriodically(period, Source{}, check_interval)
+    { }
+
     template<class Duration>
-    Periodically(const Duration& period)
+    BasicPeriodically(const Duration& period, Source source, std::uint32_t check_interval = 1)
 	: period_(period)
+	, source_(source)
+	, check_interval_(check_interval > 0 ? check_interval : 1)
     { }
 
     bool operator()() {
-	auto tp = chron::TimePoint::now();
+	if (--countdown_ > 0)
+	    return false;
+	countdown_ = check_interval_;
+
+	TimePoint tp = source_.now();
 	if (tp < next_)
 	    return false;
 	next_ = tp + period_;
@@ -25,6 +69,11 @@ public:
 private:
     chron::nanos period_;
     chron::TimePoint next_;
+    Source source_;
+    std::uint32_t check_interval_;
+    std::uint32_t countdown_{1};
 };
 
+using Periodically = BasicPeriodically<SystemTimeSource>;
+
 }; // chron
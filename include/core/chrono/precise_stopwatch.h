@@ -0,0 +1,81 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include "core/chrono/tsc_clock.h"
+
+namespace chron
+{
+
+// Summary statistics for repeated timing trials in nanoseconds.
+struct TrialStats {
+    // Return the statistics for the given `samples`.
+    static TrialStats from(std::vector<double> samples);
+
+    std::size_t trials{0};
+    double min{0}, median{0}, mad{0};
+};
+
+std::ostream& operator<<(std::ostream& os, const TrialStats& stats);
+
+// The **PreciseStopWatch** class measures short intervals using serializing reads of the
+// time-stamp counter (`lfence; rdtsc; lfence` to start and `rdtscp; lfence` to stop) so
+// that neither the compiler nor the processor can move the timed code outside of the
+// measurement. The cost of an empty measurement is calibrated at construction and
+// subtracted from every result.
+class PreciseStopWatch {
+public:
+    // Construct a stopwatch, calibrating the timer overhead over `calibration_trials`
+    // empty measurements.
+    PreciseStopWatch(int calibration_trials = 1000);
+
+    // Return the calibrated overhead of a measurement in ticks.
+    std::uint64_t overhead() const { return overhead_; }
+
+    // Return the clock used to convert ticks to nanos.
+    const core::chrono::TscClock& clock() const { return clock_; }
+
+    // Begin a measurement.
+    void start() { start_ = core::chrono::TscClock::ticks_begin(); }
+
+    // End a measurement and return the elapsed nanos less the timer overhead.
+    double stop() {
+	auto end = core::chrono::TscClock::ticks_end();
+	auto elapsed = end - start_;
+	elapsed = elapsed > overhead_ ? elapsed - overhead_ : 0;
+	return elapsed * clock_.nanos_per_tick();
+    }
+
+    // Return the nanos for a single invocation of `func`.
+    template<class F>
+    double time(F&& func) {
+	start();
+	func();
+	return stop();
+    }
+
+    // Run `trials` trials of `iterations` invocations of `func` and return the statistics
+    // of the per-invocation nanos.
+    template<class F>
+    TrialStats measure(F&& func, int trials = 100, int iterations = 1) {
+	std::vector<double> samples;
+	samples.reserve(trials);
+	for (auto i = 0; i < trials; ++i) {
+	    start();
+	    for (auto j = 0; j < iterations; ++j)
+		func();
+	    samples.push_back(stop() / iterations);
+	}
+	return TrialStats::from(std::move(samples));
+    }
+
+private:
+    core::chrono::TscClock clock_;
+    std::uint64_t overhead_{0};
+    std::uint64_t start_{0};
+};
+
+}; // chron
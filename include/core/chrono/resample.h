@@ -0,0 +1,105 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+#include "core/chrono/day_boundaries.h"
+#include "core/chrono/timepoint.h"
+
+namespace core::chrono {
+
+// The **Bucketer** class assigns **TimePoint**s to buckets that are either a fixed
+// duration (e.g. 1s or 5min) measured from local midnight or a calendar period (day,
+// week, month or quarter) in a given timezone. Bucket ids increase with time, so sorted
+// input produces sorted ids. Bucket boundaries come from the **DayBoundaries** table for
+// the zone, and `bucketize` reuses the current bucket until an input crosses its
+// boundary, so bucketing sorted data does no per-element timezone conversion.
+//
+// Fixed duration buckets do not cross midnight: the last bucket of a day is truncated at
+// the start of the next day (which also absorbs DST days that are 23 or 25 hours long).
+// Weeks start on Monday.
+class Bucketer {
+public:
+    enum class Period : std::uint8_t { Day, Week, Month, Quarter };
+
+    // A bucket is identified by `id` and covers the interval [`begin`, `end`).
+    struct Bucket {
+	std::int64_t id;
+	TimePoint begin, end;
+
+	bool contains(const TimePoint& tp) const { return tp >= begin and tp < end; }
+    };
+
+    // Construct a bucketer for buckets of `width` from local midnight in the timezone
+    // `tzname`. The `width` must be positive and no more than a day.
+    Bucketer(nanos width, const TimeZoneName& tzname = TimeZoneName{});
+
+    // Construct a bucketer for the calendar `period` in the timezone `tzname`.
+    Bucketer(Period period, const TimeZoneName& tzname = TimeZoneName{});
+
+    // Return the bucket containing `tp`.
+    Bucket bucket(const TimePoint& tp) const;
+
+    // Return the start of the bucket containing `tp`.
+    TimePoint floor(const TimePoint& tp) const {
+	return bucket(tp).begin;
+    }
+
+    // Return `tp` if it is the start of a bucket and otherwise the start of the next
+    // bucket.
+    TimePoint ceil(const TimePoint& tp) const {
+	auto b = bucket(tp);
+	return b.begin == tp ? tp : b.end;
+    }
+
+    // Store the bucket id for each of the `tps` into the corresponding element of `ids`,
+    // which must be at least as large as `tps`.
+    void bucketize(std::span<const TimePoint> tps, std::span<std::int64_t> ids) const;
+
+    // Return the bucket id for each of the `tps`.
+    std::vector<std::int64_t> bucketize(std::span<const TimePoint> tps) const;
+
+private:
+    const DayBoundaries *table_;
+    std::int64_t width_{0};
+    Period period_{Period::Day};
+};
+
+// The **Bar** struct summarizes the values observed in one bucket.
+struct Bar {
+    Bucketer::Bucket bucket;
+    double open{0}, high{0}, low{0}, close{0}, sum{0};
+    std::int64_t count{0};
+};
+
+std::ostream& operator<<(std::ostream& os, const Bar& bar);
+
+// The **Resampler** class aggregates a time-ordered stream of observations into **Bar**s
+// for the buckets of a **Bucketer**. Only buckets containing at least one observation
+// produce a bar.
+class Resampler {
+public:
+    Resampler(const Bucketer& bucketer)
+	: bucketer_(bucketer) {
+    }
+
+    // Return the bucketer.
+    const Bucketer& bucketer() const { return bucketer_; }
+
+    // Add the observation `value` at `tp`. If `tp` falls after the current bucket, return
+    // the completed bar for the current bucket. Throws if `tp` is before the current
+    // bucket.
+    std::optional<Bar> add(const TimePoint& tp, double value);
+
+    // Return the bar for the current bucket, if any, and reset the resampler.
+    std::optional<Bar> flush();
+
+private:
+    Bucketer bucketer_;
+    std::optional<Bar> bar_;
+};
+
+}; // core::chrono
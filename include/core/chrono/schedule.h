@@ -0,0 +1,97 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <array>
+#include <vector>
+#include "core/chrono/date.h"
+#include "core/chrono/time_of_day.h"
+#include "core/chrono/timepoint.h"
+
+namespace core::chrono {
+
+// The **Schedule** class represents a recurring set of fire instants defined by calendar
+// rules in a given timezone, e.g. "weekdays at 09:30 and 16:00 America/New_York" or "the
+// last business day of each month at 17:00". The next several fire instants are
+// precomputed as plain **TimePoint**s so that checking whether the schedule is due is a
+// single comparison. The instants are only recomputed after they have all passed or when
+// the timezone rules change.
+class Schedule {
+public:
+    // The number of fire instants computed ahead of time.
+    static constexpr std::size_t Depth = 8;
+
+    // A set of days of the week where bit `n` corresponds to the weekday with C encoding
+    // `n` (0 is Sunday).
+    using WeekdayMask = std::uint8_t;
+    static constexpr WeekdayMask EveryDay = 0b1111111;
+    static constexpr WeekdayMask Weekdays = 0b0111110;
+
+    // The rule used to select the days on which the schedule fires.
+    enum class Rule : std::uint8_t {
+	// Every day in the weekday mask.
+	Weekly,
+	// The first day of each month in the weekday mask.
+	FirstBusinessDayOfMonth,
+	// The last day of each month in the weekday mask.
+	LastBusinessDayOfMonth
+    };
+
+    // Construct a schedule that fires at each of the `times` on the days selected by `rule`
+    // and `mask` in the timezone `tzname`. Only instants at or after `from` are scheduled.
+    Schedule(Rule rule,
+	     std::vector<TimeOfDay> times,
+	     const TimeZoneName& tzname = TimeZoneName{},
+	     WeekdayMask mask = Weekdays,
+	     TimePoint from = TimePoint::now());
+
+    // Return a schedule that fires at each of the `times` on the days in `mask`.
+    static Schedule weekly(WeekdayMask mask,
+			   std::vector<TimeOfDay> times,
+			   const TimeZoneName& tzname = TimeZoneName{},
+			   TimePoint from = TimePoint::now());
+
+    // Return true if the day `date` is selected by the schedule's rule.
+    bool matches(const Date& date) const;
+
+    // Return the next fire instant, or **TimePoint::max()** if there is none.
+    TimePoint next() const { return next_; }
+
+    // Return true if the next fire instant is at or before `tp`.
+    bool due(TimePoint tp) const { return tp >= next_; }
+
+    // Return true if the schedule is due at `tp` and, if so, advance past every fire
+    // instant at or before `tp`.
+    bool operator()(TimePoint tp = TimePoint::now()) {
+	if (tp < next_)
+	    return false;
+	advance(tp);
+	return true;
+    }
+
+    // Advance past every fire instant at or before `tp`.
+    void advance(TimePoint tp);
+
+    // Discard the precomputed fire instants and recompute them starting at `from`.
+    void rebuild(TimePoint from);
+
+    // Rebuild the fire instants starting at `from` if the timezone rules have changed since
+    // they were computed. Return true if the schedule was rebuilt.
+    bool refresh(TimePoint from = TimePoint::now());
+
+private:
+    // Fill the fire instants with the instants after `after` starting at `cursor_`.
+    void fill(TimePoint after);
+
+    TimePoint next_;
+    std::uint8_t head_{0}, count_{0};
+    Rule rule_;
+    WeekdayMask mask_;
+    std::array<TimePoint, Depth> fires_;
+    Date cursor_;
+    TimeZoneName tzname_;
+    std::vector<TimeOfDay> times_;
+    std::string version_;
+};
+
+}; // core::chrono
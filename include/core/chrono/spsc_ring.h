@@ -0,0 +1,83 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+namespace core::chrono {
+
+// The **SpscRing** class is a bounded lock-free ring buffer for a single producer thread
+// and a single consumer thread. The capacity is rounded up to a power of two. Each side
+// caches the other side's index so that the common case touches only its own cache line.
+template<class T>
+class SpscRing {
+public:
+    SpscRing(std::size_t capacity)
+	: mask_(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1)
+	, data_(mask_ + 1)
+    { }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // Return the capacity of the ring.
+    std::size_t capacity() const { return mask_ + 1; }
+
+    // Return true if the ring is empty. Only exact when called from the consumer.
+    bool empty() const {
+	return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    // Append `value` to the ring. Return false if the ring is full. Producer only.
+    bool push(const T& value) {
+	auto tail = tail_.load(std::memory_order_relaxed);
+	if (tail - head_cache_ > mask_) {
+	    head_cache_ = head_.load(std::memory_order_acquire);
+	    if (tail - head_cache_ > mask_)
+		return false;
+	}
+	data_[tail & mask_] = value;
+	tail_.store(tail + 1, std::memory_order_release);
+	return true;
+    }
+
+    // Remove the oldest element into `value`. Return false if the ring is empty. Consumer
+    // only.
+    bool pop(T& value) {
+	auto head = head_.load(std::memory_order_relaxed);
+	if (head == tail_cache_) {
+	    tail_cache_ = tail_.load(std::memory_order_acquire);
+	    if (head == tail_cache_)
+		return false;
+	}
+	value = data_[head & mask_];
+	head_.store(head + 1, std::memory_order_release);
+	return true;
+    }
+
+    // Invoke `func` on each available element and remove them. Return the number of
+    // elements consumed. Consumer only.
+    template<class F>
+    std::size_t consume(F&& func) {
+	auto head = head_.load(std::memory_order_relaxed);
+	auto tail = tail_cache_ = tail_.load(std::memory_order_acquire);
+	for (auto i = head; i != tail; ++i)
+	    func(data_[i & mask_]);
+	head_.store(tail, std::memory_order_release);
+	return tail - head;
+    }
+
+private:
+    const std::uint64_t mask_;
+    std::vector<T> data_;
+    alignas(64) std::atomic<std::uint64_t> head_{0};
+    std::uint64_t tail_cache_{0};
+    alignas(64) std::atomic<std::uint64_t> tail_{0};
+    std::uint64_t head_cache_{0};
+};
+
+}; // core::chrono
@@ -0,0 +1,161 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <vector>
+#include "core/chrono/periodically.h"
+
+namespace core::chrono {
+
+namespace detail {
+
+// Return a small ordinal unique among the live threads. The ordinal of a thread that has
+// exited is reused, smallest first, so the live threads keep distinct small ordinals.
+inline std::size_t thread_ordinal() {
+    struct Ordinals {
+	std::mutex mutex;
+	std::set<std::size_t> free;
+	std::size_t next{0};
+    };
+    static Ordinals ordinals;
+
+    struct Ordinal {
+	Ordinal() {
+	    std::lock_guard lock(ordinals.mutex);
+	    if (ordinals.free.empty()) {
+		value = ordinals.next++;
+	    } else {
+		value = *ordinals.free.begin();
+		ordinals.free.erase(ordinals.free.begin());
+	    }
+	}
+	~Ordinal() {
+	    std::lock_guard lock(ordinals.mutex);
+	    ordinals.free.insert(value);
+	}
+	std::size_t value;
+    };
+    thread_local Ordinal ordinal;
+    return ordinal.value;
+}
+
+}; // detail
+
+// The **BasicStampGenerator** class issues unique, strictly increasing **TimePoint**s from
+// any number of threads, e.g. for use as event ids. Each thread is assigned one of
+// `slots` slots (a power of two) on its own cache line, and a slot issues only stamps
+// whose low bits are its index, i.e. the nanoseconds since the epoch rounded up to the
+// slot's residue class. Two threads stamping in the same nanosecond therefore get
+// different stamps without touching a shared cache line.
+//
+// For the stamps to be in a global order, a stamp is not returned until the clock has
+// reached it. Any stamp requested after another has been returned, on any thread, is then
+// larger. The wait is less than `slots` nanoseconds when a slot stamps less often than
+// that, but it also limits each slot to one stamp per `slots` nanoseconds and threads
+// sharing a slot queue behind each other. Each slot also remembers the latest clock
+// reading taken for it: a reading earlier than that means the clock has stepped back, in
+// which case stamps continue from the last stamp of each slot without waiting and the
+// order across slots only holds again once the clock catches up.
+//
+// The **BasicAtomicStampGenerator** class below trades scalability for full nanosecond
+// resolution and no waiting.
+template<chron::TimeSource Source>
+class BasicStampGenerator {
+public:
+    explicit BasicStampGenerator(std::size_t slots = 64, Source source = Source{})
+	: mask_(std::bit_ceil(std::max<std::size_t>(slots, 1)) - 1)
+	, slots_(mask_ + 1)
+	, source_(source) {
+    }
+
+    BasicStampGenerator(const BasicStampGenerator&) = delete;
+    BasicStampGenerator& operator=(const BasicStampGenerator&) = delete;
+
+    // Return the number of slots.
+    std::size_t slots() const { return mask_ + 1; }
+
+    // Return the index of the slot that issued `stamp`.
+    std::size_t slot(const TimePoint& stamp) const {
+	return std::uint64_t(stamp.time_since_epoch().count()) & mask_;
+    }
+
+    // Return the next stamp.
+    TimePoint operator()() {
+	auto residue = detail::thread_ordinal() & mask_;
+	auto& slot = slots_[residue];
+	auto now = read();
+	auto prev = slot.last.load(std::memory_order_relaxed);
+	std::int64_t stamp;
+	do {
+	    auto base = std::uint64_t(std::max(now, prev + 1));
+	    stamp = std::int64_t(base + ((residue - base) & mask_));
+	} while (not slot.last.compare_exchange_weak(prev, stamp, std::memory_order_relaxed));
+
+	// Wait for a fresh reading to reach the stamp unless it shows the clock behind a
+	// reading already taken, i.e. the clock has stepped back.
+	auto latest = slot.latest.load(std::memory_order_acquire);
+	auto high = std::max(now, latest);
+	for (now = read(); now < stamp and now >= high; now = read())
+	    high = now;
+	while (latest < now and not slot.latest.compare_exchange_weak
+	       (latest, now, std::memory_order_release, std::memory_order_acquire));
+	return TimePoint{stamp};
+    }
+
+private:
+    // The `last` stamp issued and the `latest` clock reading taken for a slot.
+    struct alignas(64) Slot {
+	std::atomic<std::int64_t> last{std::numeric_limits<std::int64_t>::min() / 2};
+	std::atomic<std::int64_t> latest{std::numeric_limits<std::int64_t>::min()};
+    };
+
+    std::int64_t read() const { return source_.now().time_since_epoch().count(); }
+
+    const std::uint64_t mask_;
+    std::vector<Slot> slots_;
+    Source source_;
+};
+
+// The **BasicAtomicStampGenerator** class issues unique, strictly increasing
+// **TimePoint**s from any number of threads using a single atomic: each stamp is the
+// later of the current time and one nanosecond after the previous stamp. The stamps have
+// full resolution and are in the order they were issued without waiting, but every
+// stamp updates the same cache line, so throughput falls as threads are added. Under a
+// sustained rate of more than one stamp per nanosecond the stamps run ahead of the clock.
+template<chron::TimeSource Source>
+class BasicAtomicStampGenerator {
+public:
+    explicit BasicAtomicStampGenerator(Source source = Source{})
+	: source_(source) {
+    }
+
+    BasicAtomicStampGenerator(const BasicAtomicStampGenerator&) = delete;
+    BasicAtomicStampGenerator& operator=(const BasicAtomicStampGenerator&) = delete;
+
+    // Return the next stamp.
+    TimePoint operator()() {
+	auto now = source_.now().time_since_epoch().count();
+	auto prev = last_.load(std::memory_order_relaxed);
+	std::int64_t stamp;
+	do {
+	    stamp = std::max(now, prev + 1);
+	} while (not last_.compare_exchange_weak(prev, stamp, std::memory_order_relaxed));
+	return TimePoint{stamp};
+    }
+
+private:
+    alignas(64) std::atomic<std::int64_t> last_{std::numeric_limits<std::int64_t>::min() / 2};
+    Source source_;
+};
+
+using StampGenerator = BasicStampGenerator<chron::SystemTimeSource>;
+using AtomicStampGenerator = BasicAtomicStampGenerator<chron::SystemTimeSource>;
+
+}; // core::chrono
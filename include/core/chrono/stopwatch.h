@@ -20,11 +20,14 @@ public:
 	, m_last_tp(m_start_tp)
     { }
 
+    // Return the current time. The signal fences keep the compiler from moving the timed
+    // code across the clock read, but do not serialize the processor; use
+    // **PreciseStopWatch** for nanosecond-scale measurements.
     auto now() const
     {
-	std::atomic_thread_fence(std::memory_order_relaxed);
+	std::atomic_signal_fence(std::memory_order_seq_cst);
 	auto current_tp = Clock::now();
-	std::atomic_thread_fence(std::memory_order_relaxed);
+	std::atomic_signal_fence(std::memory_order_seq_cst);
 	return current_tp;
     }
 
@@ -0,0 +1,154 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <atomic>
+#include <fstream>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/chrono/duration.h"
+#include "core/chrono/spsc_ring.h"
+#include "core/chrono/zoned_timepoint.h"
+
+namespace core::chrono {
+
+// The **TimeLog** defers the formatting of timestamps off the threads that produce them.
+// A producing thread records the raw nanoseconds of a **TimePoint** together with a zone
+// id (as returned by **ZonedTimePoint::zone_id**), a format id (as returned by
+// **TimeLog::format_id**) and a caller defined tag into its own lock-free ring buffer,
+// which costs a few nanoseconds instead of the microsecond or so of `to_string`. A
+// background flusher thread periodically drains the rings and either renders each record
+// as text using **ZonedTimePoint::to_string** or, for the lowest overhead, writes the
+// records in a compact binary form which **TimeLog::decode** (or the
+// `chrono_time_log_decode` tool) later turns into the same text. Records are only taken
+// while the log is started; when a ring is full new records are dropped and counted.
+//
+// A text line is the thread number, the tag and the formatted timestamp separated by tabs.
+// The binary form is the magic `ChronTL1` followed by blocks in host byte order: a
+// format (`F`, u16 id, u32 length, text) or zone (`Z`, u16 id, u32 length, name)
+// definition precedes the first record that uses it, and records come in batches (`R`,
+// u32 thread, u32 count, **Record**[count]). Zone id 0 is UTC.
+class TimeLog {
+public:
+    using ZoneId = ZonedTimePoint::ZoneId;
+    using FormatId = std::uint16_t;
+
+    // The output written by the flusher.
+    enum class Output { Text, Binary };
+
+    // A captured timestamp.
+    struct Record {
+	std::int64_t nanos;
+	ZoneId zone;
+	FormatId format;
+	std::uint32_t tag;
+    };
+
+    // Return the process-wide log.
+    static TimeLog& instance();
+
+    // Return the id for the format `fmt`, registering it if necessary. The id of the
+    // default format `%F %T` is 0.
+    static FormatId format_id(const std::string& fmt);
+
+    // Return the id for the timezone `tzname`.
+    static ZoneId zone_id(const TimeZoneName& tzname) {
+	return ZonedTimePoint::zone_id(tzname);
+    }
+
+    // Read the binary log from `is` and write it to `os` as text. Throw if the log is
+    // malformed.
+    static void decode(std::istream& is, std::ostream& os);
+
+    // Return true if records are being taken.
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    // Start taking records and writing them to the file `path` as `output` every
+    // `interval`. Each thread's ring holds `capacity` records.
+    void start(const std::string& path,
+	       Output output = Output::Text,
+	       chron::nanos interval = chron::millis{10},
+	       std::size_t capacity = 1 << 16);
+
+    // Stop taking records, write any remaining records and close the file.
+    void stop();
+
+    // Return the number of records dropped because a ring was full.
+    std::uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    // Record the instant `tp` to be formatted in the timezone `zone` using the format
+    // `format` from the calling thread. An unknown zone is rendered as UTC and an unknown
+    // format as `?`.
+    void record(const TimePoint& tp, ZoneId zone, FormatId format = 0, std::uint32_t tag = 0) {
+	if (not enabled())
+	    return;
+	if (not local().push({tp.time_since_epoch().count(), zone, format, tag}))
+	    dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ~TimeLog();
+
+private:
+    using Ring = SpscRing<Record>;
+
+    struct Buffer {
+	Buffer(std::size_t capacity, std::uint32_t tid)
+	    : ring(capacity)
+	    , tid(tid)
+	{ }
+	Ring ring;
+	std::uint32_t tid;
+    };
+
+    TimeLog() = default;
+
+    // Return the ring for the calling thread, creating it if necessary.
+    Ring& local() {
+	thread_local std::shared_ptr<Buffer> buffer;
+	if (not buffer)
+	    buffer = attach();
+	return buffer->ring;
+    }
+
+    std::shared_ptr<Buffer> attach();
+    void flush();
+
+    // Return the format for `id`, copying the formats registered since the last call, or
+    // `?` if there is no such format.
+    const std::string& flush_format(FormatId id);
+
+    void write_text(std::uint32_t tid, const std::vector<Record>& records);
+    void write_binary(std::uint32_t tid, const std::vector<Record>& records);
+
+    std::atomic<bool> enabled_{false};
+    std::atomic<std::uint64_t> dropped_{0};
+
+    // The registry of rings and formats, which producing threads briefly lock.
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<Buffer>> buffers_;
+    std::vector<std::string> formats_{"%F %T"};
+    std::uint32_t next_tid_{0};
+    std::size_t capacity_{1 << 16};
+
+    // The output state, which is only locked to flush so the rendering and writing never
+    // block a producing thread.
+    std::mutex flush_mutex_;
+    Output output_{Output::Text};
+    std::ofstream ofs_;
+    std::vector<std::shared_ptr<Buffer>> flush_buffers_;
+    std::vector<std::string> flush_formats_;
+    std::vector<bool> formats_written_, zones_written_, zones_registered_;
+    std::vector<Record> batch_;
+    std::atomic<bool> done_{false};
+    std::thread thread_;
+};
+
+}; // core::chrono
+
+namespace chron {
+using namespace core::chrono;
+};
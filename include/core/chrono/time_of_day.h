@@ -4,7 +4,12 @@
 #pragma once
 #include <chrono>
 #include <compare>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <string_view>
 #include "core/chrono/duration.h"
+#include "core/chrono/hash.h"
 #include "core/util/json.h"
 
 // Compare two **std::chrono::hh_mm_ss**'s.
@@ -19,31 +24,146 @@ namespace core::chrono {
 
 using TimeOfDayBase = std::chrono::hh_mm_ss<nanos>;
 
-// The TimeOfday class represents a duration from midnight with nanosecond resolution.
-class TimeOfDay : public TimeOfDayBase {
+// The **TimeOfDay** class represents a duration from midnight with nanosecond
+// resolution. It is stored as a single count of nanoseconds (rather than the separate
+// fields of **std::chrono::hh_mm_ss**) so that comparison, hashing and arithmetic are
+// single integer operations; the hours, minutes, seconds and subseconds are computed on
+// demand.
+class TimeOfDay {
 public:
-    using TimeOfDayBase::TimeOfDayBase;
-
     // Return the first instant of the day.
-    static TimeOfDay min();
+    static constexpr TimeOfDay min() { return TimeOfDay{nanos{0}}; }
 
     // Return the last instant of the day.
-    static TimeOfDay max();
+    static constexpr TimeOfDay max() { return TimeOfDay{nanos{24 * NanosPerHour - 1}}; }
+
+    // Construct midnight.
+    TimeOfDay() = default;
+
+    // Construct a **TimeOfDay** from the duration `d` since midnight.
+    constexpr explicit TimeOfDay(nanos d)
+	: ns_(d.count()) {
+    }
 
-    // Construct a **TimeOfDay** from the base class.
-    TimeOfDay(const TimeOfDayBase& base);
+    // Construct a **TimeOfDay** from a **std::chrono::hh_mm_ss**.
+    constexpr TimeOfDay(const TimeOfDayBase& base)
+	: ns_(base.to_duration().count()) {
+    }
 
     // Construct a **TimeOfDay** from the individual components.
-    TimeOfDay(int hours, int minutes, int seconds, std::int64_t ns = 0);
+    constexpr TimeOfDay(int hours, int minutes, int seconds, std::int64_t ns = 0)
+	: ns_(ns + NanosPerSecond * (seconds + 60 * (minutes + 60 * std::int64_t{hours}))) {
+    }
 
     // Construct a **TimeOfDay** from the supplied `str`.
     TimeOfDay(const std::string& str);
-    
+
+    // Return the equivalent **std::chrono::hh_mm_ss**.
+    constexpr explicit operator TimeOfDayBase() const { return TimeOfDayBase{to_duration()}; }
+
+    // Return the duration since midnight.
+    constexpr nanos to_duration() const { return nanos{ns_}; }
+    constexpr explicit operator nanos() const { return to_duration(); }
+
+    // Return the number of nanoseconds since midnight.
+    constexpr std::int64_t count() const { return ns_; }
+
+    // Return true if this is before midnight.
+    constexpr bool is_negative() const { return ns_ < 0; }
+
+    // Return the fields of the magnitude of the duration since midnight.
+    constexpr std::chrono::hours hours() const {
+	return std::chrono::hours{magnitude() / NanosPerHour};
+    }
+    constexpr std::chrono::minutes minutes() const {
+	return std::chrono::minutes{magnitude() / NanosPerMinute % 60};
+    }
+    constexpr std::chrono::seconds seconds() const {
+	return std::chrono::seconds{magnitude() / NanosPerSecond % 60};
+    }
+    constexpr nanos subseconds() const {
+	return nanos{magnitude() % NanosPerSecond};
+    }
+
+    // Add or subtract the duration `d`.
+    constexpr TimeOfDay& operator+=(nanos d) { ns_ += d.count(); return *this; }
+    constexpr TimeOfDay& operator-=(nanos d) { ns_ -= d.count(); return *this; }
+    friend constexpr TimeOfDay operator+(TimeOfDay tod, nanos d) { return tod += d; }
+    friend constexpr TimeOfDay operator-(TimeOfDay tod, nanos d) { return tod -= d; }
+
+    // Return the duration from `b` to `a`.
+    friend constexpr nanos operator-(const TimeOfDay& a, const TimeOfDay& b) {
+	return nanos{a.ns_ - b.ns_};
+    }
+
     // Compare with other **TimeOfday**.
     auto operator<=>(const TimeOfDay& other) const = default;
     bool operator==(const TimeOfDay& other) const = default;
+
+private:
+    static constexpr std::int64_t NanosPerSecond = 1'000'000'000;
+    static constexpr std::int64_t NanosPerMinute = 60 * NanosPerSecond;
+    static constexpr std::int64_t NanosPerHour = 60 * NanosPerMinute;
+
+    constexpr std::int64_t magnitude() const { return ns_ < 0 ? -ns_ : ns_; }
+
+    std::int64_t ns_{0};
 };
 
+namespace detail {
+
+// Return the value of the run of between `min_digits` and `max_digits` decimal digits at
+// `pos` in `str`, advancing `pos` past them. Throws if there are too few digits, which
+// makes it a compile error when evaluated in a constant expression.
+constexpr std::int64_t parse_digits(std::string_view str, std::size_t& pos,
+				    std::size_t min_digits, std::size_t max_digits) {
+    std::int64_t value{0};
+    auto begin = pos;
+    while (pos < str.size() and pos - begin < max_digits and str[pos] >= '0' and str[pos] <= '9')
+	value = 10 * value + (str[pos++] - '0');
+    if (pos - begin < min_digits)
+	throw std::invalid_argument("chrono literal: expected a digit");
+    return value;
+}
+
+// Return the nanoseconds since midnight for the time of day `H[H][:MM[:SS[.fraction]]]`
+// at `pos` in `str`, advancing `pos` past it.
+constexpr std::int64_t parse_time_of_day(std::string_view str, std::size_t& pos) {
+    std::int64_t hours = parse_digits(str, pos, 1, 2), minutes{0}, seconds{0}, ns{0};
+    if (pos < str.size() and str[pos] == ':') {
+	minutes = parse_digits(str, ++pos, 2, 2);
+	if (pos < str.size() and str[pos] == ':') {
+	    seconds = parse_digits(str, ++pos, 2, 2);
+	    if (pos < str.size() and str[pos] == '.') {
+		auto begin = ++pos;
+		ns = parse_digits(str, pos, 1, 9);
+		for (auto n = pos - begin; n < 9; ++n)
+		    ns *= 10;
+	    }
+	}
+    }
+    if (hours > 23 or minutes > 59 or seconds > 59)
+	throw std::invalid_argument("chrono literal: time of day out of range");
+    return TimeOfDay{int(hours), int(minutes), int(seconds), ns}.count();
+}
+
+}; // detail
+
+namespace literals {
+
+// Return the **TimeOfDay** for `str` of the form `HH:MM[:SS[.fraction]]` (e.g.
+// `"09:30"_tod`), which is parsed and checked at compile time.
+consteval TimeOfDay operator""_tod(const char *str, std::size_t size) {
+    std::string_view view{str, size};
+    std::size_t pos{0};
+    auto ns = detail::parse_time_of_day(view, pos);
+    if (pos != size)
+	throw std::invalid_argument("chrono literal: trailing characters");
+    return TimeOfDay{nanos{ns}};
+}
+
+}; // literals
+
 void to_json(json& j, const TimeOfDay& date);
 void from_json(const json& j, TimeOfDay& date);
 
@@ -58,6 +178,14 @@ template<> struct lexical_cast_impl<core::chrono::TimeOfDay> {
 };
 }; // core::detail
 
+template<>
+struct std::hash<core::chrono::TimeOfDay> {
+    std::size_t operator()(const core::chrono::TimeOfDay& tod) const noexcept {
+	return core::chrono::detail::mix64(tod.count());
+    }
+};
+
 namespace chron {
 using namespace core::chrono;
+using namespace core::chrono::literals;
 };
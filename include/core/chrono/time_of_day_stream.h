@@ -2,6 +2,8 @@
 //
 
 #pragma once
+#include <span>
+#include "core/chrono/counter_rng.h"
 #include "core/chrono/time_of_day.h"
 #include "coro/stream/sampler.h"
 
@@ -12,6 +14,16 @@ struct Sampler<chron::TimeOfDay> {
     Generator<chron::TimeOfDay> operator()
     (chron::TimeOfDay start = chron::TimeOfDay::min(),
      chron::TimeOfDay end = chron::TimeOfDay::max()) const;
+
+    // Fill `out` with times of day uniformly distributed in [`start`, `end`] where element `i`
+    // is the value at position `index + i` of the counter-based stream for `seed`. The
+    // output depends only on the seed and positions, so a large span can be filled by
+    // threads filling disjoint subspans with the corresponding `index`.
+    static void fill(std::span<chron::TimeOfDay> out,
+		     chron::TimeOfDay start,
+		     chron::TimeOfDay end,
+		     std::uint64_t seed,
+		     std::uint64_t index = 0);
 };
 
 }; // coro
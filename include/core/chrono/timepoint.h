@@ -4,6 +4,7 @@
 #pragma once
 #include <chrono>
 #include <compare>
+#include <limits>
 #include <fmt/ostream.h>
 #include "core/chrono/date.h"
 #include "core/chrono/duration.h"
@@ -32,29 +33,50 @@ public:
     using TimePointBase::TimePointBase;
 
     // Return the **TimePoint** for the epoch.
-    static TimePoint epoch();
+    static constexpr TimePoint epoch() { return TimePoint{std::int64_t{0}}; }
     
     // Return the **TimePoint** for the current time.
     static TimePoint now();
     
     // Return the **TimePoint** for the furthest representable point in the future.
-    static TimePoint max();
+    static constexpr TimePoint max() {
+	return TimePoint{std::numeric_limits<std::int64_t>::max()};
+    }
 
     // Construct a **TimePoint** from the base class.
-    TimePoint(const TimePointBase& base);
+    constexpr TimePoint(const TimePointBase& base)
+	: TimePointBase(base) {
+    }
 
     // Construct a **TimePoint** `nanos` nanoseconds after the epoch.
-    explicit TimePoint(std::int64_t nanos = 0);
+    constexpr explicit TimePoint(std::int64_t nanos = 0)
+	: TimePointBase(std::chrono::nanoseconds{nanos}) {
+    }
 
     // Construct a **TimePoint** `ts` seconds after the epoch.
-    explicit TimePoint(double ts);
+    constexpr explicit TimePoint(double ts)
+	: TimePointBase(std::chrono::nanoseconds{std::int64_t(1e9 * ts)}) {
+    }
 
     // Construct a **TimePoint** for midnight for the supplied `date` and `tzname`.
-    explicit TimePoint(const Date& date, const TimeZoneName& tzname = TimeZoneName{});
+    explicit TimePoint(const Date& date, const TimeZoneName& tzname);
+
+    // Construct a **TimePoint** for midnight for the supplied `date` in UTC or at the
+    // fixed `offset` from UTC.
+    constexpr explicit TimePoint(const Date& date, FixedOffset offset = Utc{})
+	: TimePoint(date, TimeOfDay{}, offset) {
+    }
 
     // Construct a **TimePoint** for the supplied `date`, `time_of_day` and `tzname`.
-    explicit TimePoint(const Date& date, const TimeOfDay& tod,
-		       const TimeZoneName& tzname = TimeZoneName{});
+    explicit TimePoint(const Date& date, const TimeOfDay& tod, const TimeZoneName& tzname);
+
+    // Construct a **TimePoint** for the supplied `date` and `time_of_day` in UTC or at the
+    // fixed `offset` from UTC.
+    constexpr explicit TimePoint(const Date& date, const TimeOfDay& tod,
+				 FixedOffset offset = Utc{})
+	: TimePointBase(date::sys_days{date}.time_since_epoch() + tod.to_duration()
+			- std::chrono::nanoseconds{offset.offset_nanos()}) {
+    }
 
     // Construct a date fromm the given `str`, `fmt` and timezone `tzname`.
     TimePoint(const std::string& str,
@@ -63,37 +85,69 @@ public:
 
     // Return the std::string representation for this **TimePoint** using the supplied format
     // `fmt` for the given timezone `tzname`.
-    std::string to_string(const TimeZoneName& tzname = TimeZoneName{},
-			  const std::string& fmt = "%F %T") const;
+    std::string to_string(const TimeZoneName& tzname, const std::string& fmt = "%F %T") const;
+    std::string to_string(Utc = Utc{}, const std::string& fmt = "%F %T") const;
+    std::string to_string(FixedOffset offset, const std::string& fmt = "%F %T") const;
 
     // Return the **Date** corresponding to this **TimePoint** for the given timezone
     // `tzname`.
-    Date date(const TimeZoneName& tzname = TimeZoneName{}) const;
+    Date date(const TimeZoneName& tzname) const;
+
+    // Return the **Date** corresponding to this **TimePoint** in UTC or at the fixed
+    // `offset` from UTC.
+    constexpr Date date(FixedOffset offset = Utc{}) const {
+	return Date{date::sys_days{date::days{floor_div(local_nanos(offset), NanosPerDay)}}};
+    }
 
     // Return the **TimeOfDay** corresponding to this **TimePoint**
     // for the given timezone `tzname`.
-    TimeOfDay time_of_day(const TimeZoneName& tzname = TimeZoneName{}) const;
+    TimeOfDay time_of_day(const TimeZoneName& tzname) const;
+
+    // Return the **TimeOfDay** corresponding to this **TimePoint** in UTC or at the fixed
+    // `offset` from UTC.
+    constexpr TimeOfDay time_of_day(FixedOffset offset = Utc{}) const {
+	auto nanos = local_nanos(offset);
+	return TimeOfDay{std::chrono::nanoseconds{nanos - floor_div(nanos, NanosPerDay) * NanosPerDay}};
+    }
 
     // Return the **Date** and **TimeOfDay** corresponding to this
     // **TimePoint** for the given timezone `tzname`.
-    std::pair<Date,TimeOfDay> components(const TimeZoneName& tzname = TimeZoneName{}) const;
+    std::pair<Date,TimeOfDay> components(const TimeZoneName& tzname) const;
+
+    // Return the **Date** and **TimeOfDay** corresponding to this **TimePoint** in UTC or
+    // at the fixed `offset` from UTC.
+    constexpr std::pair<Date,TimeOfDay> components(FixedOffset offset = Utc{}) const {
+	return {date(offset), time_of_day(offset)};
+    }
 
     // Return the **TimePoint** corresponding to the most recent midnight for the given
     // timezone `tzname`.
-    TimePoint midnight(const TimeZoneName& tzname = TimeZoneName{}) const;
+    TimePoint midnight(const TimeZoneName& tzname) const;
+
+    // Return the **TimePoint** corresponding to the most recent midnight in UTC or at the
+    // fixed `offset` from UTC.
+    constexpr TimePoint midnight(FixedOffset offset = Utc{}) const {
+	return *this - time_of_day(offset).to_duration();
+    }
 
     // Return the **TimePoint** corresponding to the next midnight for the given
     // timezone `tzname`.
-    TimePoint next_midnight(const TimeZoneName& tzname = TimeZoneName{}) const;
+    TimePoint next_midnight(const TimeZoneName& tzname) const;
+
+    // Return the **TimePoint** corresponding to the next midnight in UTC or at the fixed
+    // `offset` from UTC.
+    constexpr TimePoint next_midnight(FixedOffset offset = Utc{}) const {
+	return midnight(offset) + std::chrono::days{1};
+    }
 
     // Return the unix timestamp as the real-valued seconds since the
     // epoch.
-    double unix_ts() const;
+    constexpr double unix_ts() const { return 1e-9 * time_since_epoch().count(); }
 
     // Return this **TimePoint** plus the given `duration`.
     template<class Duration>
     requires is_duration_v<Duration>
-    TimePoint operator+(Duration duration) const {
+    constexpr TimePoint operator+(Duration duration) const {
 	TimePoint tp{*this};
 	return tp += duration;
     }
@@ -101,15 +155,71 @@ public:
     // Return this **TimePoint** minus the given `duration`.
     template<class Duration>
     requires is_duration_v<Duration>
-    TimePoint operator-(Duration duration) const {
+    constexpr TimePoint operator-(Duration duration) const {
 	TimePoint tp{*this};
 	return tp -= duration;
     }
 
 private:
+    static constexpr std::int64_t NanosPerDay = 86'400'000'000'000;
+
+    static constexpr std::int64_t floor_div(std::int64_t a, std::int64_t b) {
+	auto q = a / b;
+	return q - ((a % b) < 0);
+    }
+
+    // Return the nanoseconds since the local epoch at the fixed `offset` from UTC.
+    constexpr std::int64_t local_nanos(FixedOffset offset) const {
+	return time_since_epoch().count() + offset.offset_nanos();
+    }
+
     TimePointBase *base() { return this; }
 };
 
+constexpr Date::Date(const TimePoint& tp, FixedOffset offset)
+    : Date(tp.date(offset)) {
+}
+
+constexpr TimePoint Date::to_timepoint(FixedOffset offset) const {
+    return TimePoint{*this, offset};
+}
+
+namespace detail {
+
+// Return the UTC **TimePoint** for `YYYY-MM-DD[( |T)HH:MM[:SS[.fraction]]]`.
+constexpr TimePoint parse_utc(std::string_view str) {
+    std::size_t pos{0};
+    auto year = parse_digits(str, pos, 4, 4);
+    if (pos >= str.size() or str[pos] != '-')
+	throw std::invalid_argument("chrono literal: expected YYYY-MM-DD");
+    auto month = parse_digits(str, ++pos, 2, 2);
+    if (pos >= str.size() or str[pos] != '-')
+	throw std::invalid_argument("chrono literal: expected YYYY-MM-DD");
+    auto day = parse_digits(str, ++pos, 2, 2);
+    Date ymd{int(year), unsigned(month), unsigned(day)};
+    if (not ymd.ok())
+	throw std::invalid_argument("chrono literal: invalid date");
+
+    std::int64_t ns{0};
+    if (pos < str.size() and (str[pos] == ' ' or str[pos] == 'T'))
+	ns = parse_time_of_day(str, ++pos);
+    if (pos != str.size())
+	throw std::invalid_argument("chrono literal: trailing characters");
+    return TimePoint{date::sys_days{ymd}.time_since_epoch() + std::chrono::nanoseconds{ns}};
+}
+
+}; // detail
+
+namespace literals {
+
+// Return the UTC **TimePoint** for `str` of the form `YYYY-MM-DD[ HH:MM[:SS[.fraction]]]`
+// (e.g. `"2024-03-10 09:30:00"_utc`), which is parsed and checked at compile time.
+consteval TimePoint operator""_utc(const char *str, std::size_t size) {
+    return detail::parse_utc(std::string_view{str, size});
+}
+
+}; // literals
+
 std::ostream& operator<<(std::ostream& os, const TimePoint& tp);
 
 void to_json(json& j, const TimePoint& tp);
@@ -124,6 +234,13 @@ template<> struct lexical_cast_impl<core::chrono::TimePoint> {
 };
 }; // core::detail
 
+template<>
+struct std::hash<core::chrono::TimePoint> {
+    std::size_t operator()(const core::chrono::TimePoint& tp) const noexcept {
+	return core::chrono::detail::mix64(tp.time_since_epoch().count());
+    }
+};
+
 // template <> struct fmt::formatter<chron::TimePoint> : ostream_formatter {};
 
 namespace chron {
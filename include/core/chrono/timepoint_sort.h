@@ -0,0 +1,117 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "core/chrono/timepoint.h"
+
+namespace core::chrono {
+
+namespace detail {
+
+// Return the radix key for `tp`: the nanoseconds since the epoch with the sign bit flipped
+// so that unsigned order matches signed order.
+inline std::uint64_t radix_key(const TimePoint& tp) {
+    return std::uint64_t(tp.time_since_epoch().count()) ^ (std::uint64_t{1} << 63);
+}
+
+// Stable LSD radix sort of `keys` (and, if `Payload` is not void, of the corresponding
+// `values`) using one byte per pass. A single pass over the input builds the histograms
+// for all eight bytes and any byte that is the same for every key is skipped, so sorting
+// timestamps from a single day typically needs five passes rather than eight.
+template<class Payload>
+void radix_sort(std::span<TimePoint> keys, Payload *values) {
+    constexpr bool HasPayload = not std::is_void_v<Payload>;
+    using Value = std::conditional_t<HasPayload, Payload, char>;
+    static_assert(std::is_trivially_copyable_v<Value>);
+
+    auto n = keys.size();
+    if (n < 2)
+	return;
+
+    std::array<std::array<std::size_t, 256>, 8> counts{};
+    for (const auto& tp : keys) {
+	auto key = radix_key(tp);
+	for (auto b = 0; b < 8; ++b)
+	    ++counts[b][(key >> (8 * b)) & 0xff];
+    }
+
+    std::vector<TimePoint> key_buffer(n);
+    std::vector<Value> value_buffer(HasPayload ? n : 0);
+    TimePoint *src = keys.data(), *dst = key_buffer.data();
+    Value *vsrc{nullptr}, *vdst{nullptr};
+    if constexpr (HasPayload) {
+	vsrc = values;
+	vdst = value_buffer.data();
+    }
+
+    for (auto b = 0; b < 8; ++b) {
+	auto& count = counts[b];
+	if (count[(radix_key(src[0]) >> (8 * b)) & 0xff] == n)
+	    continue;
+
+	std::size_t offset{0};
+	for (auto& c : count) {
+	    auto m = c;
+	    c = offset;
+	    offset += m;
+	}
+
+	for (std::size_t i = 0; i < n; ++i) {
+	    auto j = count[(radix_key(src[i]) >> (8 * b)) & 0xff]++;
+	    dst[j] = src[i];
+	    if constexpr (HasPayload)
+		vdst[j] = vsrc[i];
+	}
+	std::swap(src, dst);
+	if constexpr (HasPayload)
+	    std::swap(vsrc, vdst);
+    }
+
+    if (src != keys.data()) {
+	std::memcpy(keys.data(), src, n * sizeof(TimePoint));
+	if constexpr (HasPayload)
+	    std::memcpy(values, vsrc, n * sizeof(Value));
+    }
+}
+
+}; // detail
+
+// Sort `tps` in ascending order using an LSD radix sort over the signed nanosecond
+// representation. This is typically several times faster than `std::sort` for large
+// inputs at the cost of a temporary buffer the size of the input.
+void radix_sort(std::span<TimePoint> tps);
+
+// Stably sort `tps` in ascending order while applying the same permutation to `values`,
+// which must have the same size as `tps`.
+template<class T>
+void radix_sort(std::span<TimePoint> tps, std::span<T> values) {
+    if (values.size() != tps.size())
+	throw core::runtime_error("radix_sort: {} values for {} timepoints",
+				  values.size(), tps.size());
+    detail::radix_sort<T>(tps, values.data());
+}
+
+// Return the permutation that stably sorts `tps`, i.e. the index into `tps` of each
+// element of the sorted sequence.
+std::vector<std::uint32_t> radix_argsort(std::span<const TimePoint> tps);
+
+// Merge the already sorted `inputs` into `output`, which must be exactly as large as the
+// inputs combined. Equal timepoints are taken from the lower numbered input first. If
+// `sources` is not empty, it must be as large as `output` and receives the index of the
+// input from which each output element was taken. The merge uses a loser tree, so each
+// output element costs about log2(k) comparisons against a compact array of the current
+// head of each input.
+void merge_sorted(std::span<const std::span<const TimePoint>> inputs,
+		  std::span<TimePoint> output,
+		  std::span<std::uint32_t> sources = {});
+
+// Return the merge of the already sorted `inputs`.
+std::vector<TimePoint> merge_sorted(std::span<const std::span<const TimePoint>> inputs);
+
+}; // core::chrono
@@ -2,7 +2,9 @@
 //
 
 #pragma once
+#include <span>
 #include "core/util/random.h"
+#include "core/chrono/counter_rng.h"
 #include "core/chrono/date.h"
 #include "core/chrono/timepoint.h"
 #include "coro/stream/sampler.h"
@@ -14,6 +16,16 @@ struct Sampler<chron::TimePoint> {
     Generator<chron::TimePoint> operator()
     (chron::TimePoint start = chron::TimePoint{chron::jan/1/1990},
      chron::TimePoint end = chron::TimePoint{chron::jan/1/2040}) const;
+
+    // Fill `out` with timepoints uniformly distributed in [`start`, `end`] where element `i`
+    // is the value at position `index + i` of the counter-based stream for `seed`. The
+    // output depends only on the seed and positions, so a large span can be filled by
+    // threads filling disjoint subspans with the corresponding `index`.
+    static void fill(std::span<chron::TimePoint> out,
+		     chron::TimePoint start,
+		     chron::TimePoint end,
+		     std::uint64_t seed,
+		     std::uint64_t index = 0);
 };
 
 }; // coro
@@ -0,0 +1,101 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include "core/chrono/date.h"
+#include "core/chrono/timepoint.h"
+
+namespace core::chrono {
+
+// The **TimestampIndex** class provides zero-copy access to a sorted column of timestamps
+// stored on disk. The file is memory mapped, so only the pages touched by a query are
+// read, and searches use a piecewise-linear model of the column: each segment predicts
+// the position of a timestamp to within `max_error` elements, so a lookup is a binary
+// search over the (small) segment table followed by a search of at most `2 * max_error`
+// elements near the prediction.
+//
+// The file consists of a fixed header, the timestamps as native-endian int64 nanoseconds
+// since the epoch and the segment table. Files are created with `TimestampIndex::write`.
+class TimestampIndex {
+public:
+    // A half-open range [`first`, `second`) of element indices.
+    using Range = std::pair<std::size_t, std::size_t>;
+
+    // Write the sorted timestamps `tps` to a new index file at `path` where each segment
+    // of the model predicts positions to within `max_error` elements.
+    static void write(const std::string& path,
+		      std::span<const TimePoint> tps,
+		      std::uint32_t max_error = 32);
+
+    // Map the index file at `path`.
+    explicit TimestampIndex(const std::string& path);
+    ~TimestampIndex();
+
+    TimestampIndex(TimestampIndex&& other);
+    TimestampIndex& operator=(TimestampIndex&& other);
+    TimestampIndex(const TimestampIndex&) = delete;
+    TimestampIndex& operator=(const TimestampIndex&) = delete;
+
+    // Return the number of timestamps.
+    std::size_t size() const { return size_; }
+
+    // Return the number of segments in the model.
+    std::size_t segments() const { return segments_; }
+
+    // Return the maximum prediction error of the model.
+    std::uint32_t max_error() const { return max_error_; }
+
+    // Return the timestamps as nanoseconds since the epoch.
+    std::span<const std::int64_t> nanos() const { return {data_, size_}; }
+
+    // Return the `i`th timestamp.
+    TimePoint operator[](std::size_t i) const { return TimePoint{data_[i]}; }
+
+    // Return the index of the first timestamp not before `tp`.
+    std::size_t lower_bound(const TimePoint& tp) const;
+
+    // Return the index of the first timestamp after `tp`.
+    std::size_t upper_bound(const TimePoint& tp) const;
+
+    // Return the range of timestamps in [`begin`, `end`).
+    Range between(const TimePoint& begin, const TimePoint& end) const {
+	auto first = lower_bound(begin);
+	return {first, std::max(first, lower_bound(end))};
+    }
+
+    // Return the range of timestamps on the dates [`begin`, `end`) in timezone `tzname`.
+    Range between(const Date& begin, const Date& end,
+		  const TimeZoneName& tzname = TimeZoneName{}) const {
+	return between(TimePoint{begin, tzname}, TimePoint{end, tzname});
+    }
+
+    // Return the range of timestamps on `date` in timezone `tzname`.
+    Range on(const Date& date, const TimeZoneName& tzname = TimeZoneName{}) const {
+	return between(date, date.tomorrow(), tzname);
+    }
+
+    // The on-disk description of a segment starting at element `index` whose first
+    // timestamp is `key`.
+    struct Segment {
+	std::int64_t key;
+	std::uint64_t index;
+	double slope;
+    };
+
+private:
+    std::size_t lower_bound(std::int64_t key) const;
+
+    void *map_{nullptr};
+    std::size_t length_{0};
+    const std::int64_t *data_{nullptr};
+    std::size_t size_{0};
+    const Segment *segment_{nullptr};
+    std::size_t segments_{0};
+    std::uint32_t max_error_{0};
+};
+
+}; // core::chrono
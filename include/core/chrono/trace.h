@@ -0,0 +1,138 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/chrono/duration.h"
+#include "core/chrono/spsc_ring.h"
+#include "core/chrono/tsc_clock.h"
+
+namespace core::chrono {
+
+// The **Tracer** collects scoped trace spans from any number of threads. Each thread
+// writes completed spans into its own lock-free ring buffer and a background flusher
+// thread periodically drains the rings and writes them in the Chrome `trace_event` JSON
+// format which can be loaded by `chrome://tracing` or Perfetto. Spans are only recorded
+// while the tracer is started; when a ring is full new spans are dropped and counted.
+//
+// Span timestamps are raw time-stamp counter values which are converted to time by the
+// flusher using a calibrated **TscClock**. This keeps the cost of a span to two counter
+// reads and a ring buffer push.
+class Tracer {
+public:
+    // A completed span.
+    struct Event {
+	std::uint32_t name;
+	std::int64_t begin, end;
+    };
+
+    // Return the process-wide tracer.
+    static Tracer& instance();
+
+    // Return the id for the span name `name`, registering it if necessary.
+    static std::uint32_t name_id(const std::string& name);
+
+    // Return the current timestamp.
+    static std::int64_t now() {
+	return TscClock::ticks();
+    }
+
+    // Return true if spans are being recorded.
+    bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+    // Start recording spans and writing them to the file `path` every `interval`. Each
+    // thread's ring holds `capacity` spans.
+    void start(const std::string& path,
+	       chron::nanos interval = chron::millis{10},
+	       std::size_t capacity = 1 << 16);
+
+    // Stop recording spans, write any remaining spans and close the file.
+    void stop();
+
+    // Return the number of spans dropped because a ring was full.
+    std::uint64_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    // Record a completed span from the calling thread.
+    void record(const Event& event) {
+	if (not local().push(event))
+	    dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ~Tracer();
+
+private:
+    using Ring = SpscRing<Event>;
+
+    struct Buffer {
+	Buffer(std::size_t capacity, std::uint32_t tid)
+	    : ring(capacity)
+	    , tid(tid)
+	{ }
+	Ring ring;
+	std::uint32_t tid;
+    };
+
+    Tracer() = default;
+
+    // Return the ring for the calling thread, creating it if necessary.
+    Ring& local() {
+	thread_local std::shared_ptr<Buffer> buffer;
+	if (not buffer)
+	    buffer = attach();
+	return buffer->ring;
+    }
+
+    std::shared_ptr<Buffer> attach();
+    void flush();
+
+    TscClock clock_;
+    std::atomic<bool> enabled_{false};
+    std::atomic<std::uint64_t> dropped_{0};
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<Buffer>> buffers_;
+    std::vector<std::string> names_;
+    std::uint32_t next_tid_{0};
+    std::size_t capacity_{1 << 16};
+    std::ofstream ofs_;
+    bool first_{true};
+    std::atomic<bool> done_{false};
+    std::thread thread_;
+};
+
+// The **TraceSpan** class records the interval between its construction and destruction
+// as a span named `name` (as returned by **Tracer::name_id**). Typical use is
+//
+//     static const auto id = Tracer::name_id("parse");
+//     TraceSpan span{id};
+class TraceSpan {
+public:
+    explicit TraceSpan(std::uint32_t name)
+	: name_(name)
+	, begin_(Tracer::instance().enabled() ? Tracer::now() : 0)
+    { }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    ~TraceSpan() {
+	if (begin_ != 0)
+	    Tracer::instance().record({name_, begin_, Tracer::now()});
+    }
+
+private:
+    std::uint32_t name_;
+    std::int64_t begin_;
+};
+
+}; // core::chrono
+
+namespace chron {
+using namespace core::chrono;
+};
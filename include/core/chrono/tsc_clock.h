@@ -0,0 +1,90 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "core/chrono/timepoint.h"
+
+namespace core::chrono {
+
+// TscClock provides very fast access to the current time by reading the processor
+// time-stamp counter and scaling it to nanoseconds. The scale is calibrated against the
+// system clock when the clock is constructed, so the clock should only be used on hosts
+// with an invariant TSC. On platforms without a TSC the steady clock is used instead.
+class TscClock {
+public:
+    // Construct a clock calibrated against the system clock over the given `interval`.
+    TscClock(chron::nanos interval = chron::millis{10});
+
+    // Return the raw time-stamp counter.
+    static std::uint64_t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return std::chrono::steady_clock::now().time_since_epoch().count();
+#endif
+    }
+
+    // Return the time-stamp counter at the start of a timed region. The read is fenced so
+    // that it is neither executed before the preceding instructions complete nor after the
+    // timed instructions begin.
+    static std::uint64_t ticks_begin() {
+#if defined(__x86_64__) || defined(__i386__)
+	_mm_lfence();
+	auto count = __rdtsc();
+	_mm_lfence();
+	return count;
+#else
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	auto count = ticks();
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	return count;
+#endif
+    }
+
+    // Return the time-stamp counter at the end of a timed region. The read waits for the
+    // timed instructions to complete and later instructions wait for the read.
+    static std::uint64_t ticks_end() {
+#if defined(__x86_64__) || defined(__i386__)
+	unsigned int aux;
+	auto count = __rdtscp(&aux);
+	_mm_lfence();
+	return count;
+#else
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	auto count = ticks();
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	return count;
+#endif
+    }
+
+    // Return the number of nanoseconds per tick.
+    double nanos_per_tick() const { return nanos_per_tick_; }
+
+    // Return the duration corresponding to `count` ticks.
+    chron::nanos to_nanos(std::int64_t count) const {
+	return chron::nanos{std::int64_t(count * nanos_per_tick_)};
+    }
+
+    // Return the time corresponding to the counter value `count`.
+    chron::TimePoint to_timepoint(std::uint64_t count) const {
+	return base_ + to_nanos(std::int64_t(count - base_ticks_));
+    }
+
+    // Return the current time.
+    chron::TimePoint now() const {
+	return to_timepoint(ticks());
+    }
+
+private:
+    chron::TimePoint base_;
+    std::uint64_t base_ticks_;
+    double nanos_per_tick_;
+};
+
+}; // core::chrono
@@ -0,0 +1,124 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#pragma once
+#include <compare>
+#include <cstdint>
+#include <string>
+#include "core/chrono/date.h"
+#include "core/chrono/time_of_day.h"
+#include "core/chrono/timepoint.h"
+
+namespace core::chrono {
+
+// The **ZonedTimePoint** class is a **TimePoint** packed together with a small id for its
+// timezone and the offsets from UTC of the local day and of the instant, in 16 bytes. The
+// offsets are resolved once on construction, so the local date, time of day and their
+// formatting are pure arithmetic no matter how many times they are requested. As for
+// **TimePoint**, the time of day is the time elapsed since the start of the local day, so
+// on days with a daylight saving transition it differs from the wall clock time.
+//
+// Zone ids are assigned by a process-wide registry on first use and are stable for the
+// life of the process (but not across processes). Id 0 denotes a fixed offset from UTC,
+// including UTC itself.
+class ZonedTimePoint {
+public:
+    using ZoneId = std::uint16_t;
+
+    // Return the id for the timezone `tzname`. Aliases of the same zone share an id.
+    static ZoneId zone_id(const TimeZoneName& tzname);
+
+    // Return the timezone for `id` or nullptr for a fixed offset.
+    static const date::time_zone *zone(ZoneId id);
+
+    // Construct the epoch in UTC.
+    constexpr ZonedTimePoint() = default;
+
+    // Construct the instant `tp` in the timezone `tzname`.
+    ZonedTimePoint(const TimePoint& tp, const TimeZoneName& tzname);
+
+    // Construct the instant `tp` in the timezone with the given `id`.
+    ZonedTimePoint(const TimePoint& tp, ZoneId id);
+
+    // Construct the instant `tp` in UTC or at the fixed `offset` from UTC.
+    constexpr ZonedTimePoint(const TimePoint& tp, FixedOffset offset = Utc{})
+	: nanos_(tp.time_since_epoch().count())
+	, day_offset_(std::int32_t(offset.offset().count() * 60)) {
+    }
+
+    // Return the instant.
+    constexpr TimePoint timepoint() const { return TimePoint{nanos_}; }
+    constexpr operator TimePoint() const { return timepoint(); }
+
+    // Return the id of the timezone.
+    constexpr ZoneId zone_id() const { return zone_; }
+
+    // Return the offset from UTC of the wall clock at this instant.
+    constexpr std::chrono::seconds offset() const {
+	return std::chrono::seconds{day_offset_ + (skew_ >> 1)};
+    }
+
+    // Return the name of the timezone or, for a fixed offset, `UTC` or `[+-]HH:MM`.
+    std::string zone_name() const;
+
+    // Return the local **Date**.
+    constexpr Date date() const {
+	return Date{date::sys_days{date::days{serial()}}};
+    }
+
+    // Return the local **TimeOfDay**.
+    constexpr TimeOfDay time_of_day() const {
+	return TimeOfDay{std::chrono::nanoseconds{day_nanos() - serial() * NanosPerDay}};
+    }
+
+    // Return the local **Date** and **TimeOfDay**.
+    constexpr std::pair<Date,TimeOfDay> components() const {
+	return {date(), time_of_day()};
+    }
+
+    // Return the same instant in the timezone `tzname`.
+    ZonedTimePoint in(const TimeZoneName& tzname) const {
+	return ZonedTimePoint{timepoint(), tzname};
+    }
+
+    // Return the std::string representation of the local time using the format `fmt`.
+    // The timezone database is consulted only if `fmt` contains `%Z`.
+    std::string to_string(const std::string& fmt = "%F %T") const;
+
+    auto operator<=>(const ZonedTimePoint& other) const = default;
+    bool operator==(const ZonedTimePoint& other) const = default;
+
+private:
+    static constexpr std::int64_t NanosPerDay = 86'400'000'000'000;
+
+    static constexpr std::int64_t floor_div(std::int64_t a, std::int64_t b) {
+	auto q = a / b;
+	return q - ((a % b) < 0);
+    }
+
+    // Return the nanoseconds since the epoch shifted by the offset of the local day.
+    constexpr std::int64_t day_nanos() const {
+	return nanos_ + std::int64_t{day_offset_} * 1'000'000'000;
+    }
+
+    // Return the serial of the local day, which is one less than the day of `day_nanos`
+    // during the hours after the 24th of a long day.
+    constexpr std::int64_t serial() const {
+	return floor_div(day_nanos(), NanosPerDay) - (skew_ & 1);
+    }
+
+    // The `day_offset_` is the offset in seconds that makes the start of the local day
+    // midnight, and `skew_` packs twice the difference in seconds between the wall clock
+    // offset and `day_offset_` with, in the low bit, whether the instant is 24 or more
+    // hours into the local day.
+    std::int64_t nanos_{0};
+    std::int32_t day_offset_{0};
+    ZoneId zone_{0};
+    std::int16_t skew_{0};
+};
+
+static_assert(sizeof(ZonedTimePoint) <= 16);
+
+std::ostream& operator<<(std::ostream& os, const ZonedTimePoint& ztp);
+
+}; // core::chrono
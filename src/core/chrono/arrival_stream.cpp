@@ -0,0 +1,142 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include <algorithm>
+#include <cmath>
+#include "core/chrono/arrival_stream.h"
+#include "core/util/json.h"
+
+namespace core::chrono
+{
+
+namespace {
+
+constexpr std::int64_t NanosPerDay = 86'400'000'000'000;
+
+// Return the instant of the local time `local` in `tz`, using the transition for local
+// times skipped by a transition and the earlier instant for repeated local times.
+TimePoint to_sys(const date::time_zone *tz, date::local_time<nanos> local) {
+    return TimePoint{tz->to_sys(local, date::choose::earliest)};
+}
+
+// Return the instant of the local time `local` in `tz` that ends the segment containing
+// `tp`. This is `to_sys` except during the second pass through a repeated local time,
+// where the earlier instant is already past and the later one is used instead.
+TimePoint end_after(const date::time_zone *tz,
+		    date::local_time<nanos> local,
+		    const TimePoint& tp) {
+    auto end = to_sys(tz, local);
+    if (end <= tp)
+	end = TimePoint{tz->to_sys(local, date::choose::latest)};
+    return end;
+}
+
+date::local_time<nanos> to_local(const date::time_zone *tz, const TimePoint& tp) {
+    return date::zoned_time{tz, date::sys_time<nanos>{tp.time_since_epoch()}}.get_local_time();
+}
+
+}; // anonymous
+
+PoissonArrivals::PoissonArrivals(double rate)
+    : scale_(1e9 / rate) {
+    if (not (rate > 0))
+	throw core::runtime_error("PoissonArrivals: rate must be positive: {}", rate);
+}
+
+HawkesArrivals::HawkesArrivals(double base_rate, double branching, nanos decay)
+    : base_rate_(base_rate)
+    , beta_(1e9 / decay.count()) {
+    if (not (base_rate > 0))
+	throw core::runtime_error("HawkesArrivals: base rate must be positive: {}", base_rate);
+    if (not (branching >= 0 and branching < 1))
+	throw core::runtime_error("HawkesArrivals: branching must be in [0, 1): {}", branching);
+    if (decay.count() <= 0)
+	throw core::runtime_error("HawkesArrivals: decay must be positive: {}ns", decay.count());
+    jump_ = branching * beta_;
+}
+
+TimePoint HawkesArrivals::next(State& state) const {
+    // The next arrival is the earlier of the next arrival triggered by the decaying excess
+    // intensity (which may never occur) and the next arrival from the base rate.
+    auto excess = state.intensity - base_rate_;
+    auto u1 = state.rng.uniform(state.index++);
+    auto u2 = state.rng.uniform(state.index++);
+    auto wait = -std::log1p(-u2) / base_rate_;
+    if (excess > 0) {
+	auto d = 1 + beta_ * std::log1p(-u1) / excess;
+	if (d > 0)
+	    wait = std::min(wait, -std::log(d) / beta_);
+    }
+
+    state.intensity = base_rate_ + excess * std::exp(-beta_ * wait) + jump_;
+    state.time += nanos{std::int64_t(1e9 * wait)};
+    return state.time;
+}
+
+TimeOfDayArrivals::TimeOfDayArrivals(std::vector<double> rates, const TimeZoneName& tzname)
+    : rates_(std::move(rates))
+    , width_(rates_.empty() ? 0 : NanosPerDay / std::int64_t(rates_.size()))
+    , tz_(Date::locate_timezone(tzname)) {
+    if (width_ <= 0)
+	throw core::runtime_error("TimeOfDayArrivals: need between 1 and {} rates: {}",
+				  NanosPerDay, rates_.size());
+    for (auto rate : rates_)
+	if (not (rate >= 0))
+	    throw core::runtime_error("TimeOfDayArrivals: rates must be non-negative: {}", rate);
+    if (*std::max_element(rates_.begin(), rates_.end()) == 0)
+	throw core::runtime_error("TimeOfDayArrivals: at least one rate must be positive");
+}
+
+std::pair<double, TimePoint> TimeOfDayArrivals::segment(const TimePoint& tp) const {
+    auto local = to_local(tz_, tp);
+    auto day = date::floor<date::days>(local);
+    auto k = std::min<std::int64_t>((local - day).count() / width_, rates_.size() - 1);
+    auto end = k + 1 == std::int64_t(rates_.size())
+	? end_after(tz_, day + date::days{1}, tp)
+	: end_after(tz_, day + nanos{(k + 1) * width_}, tp);
+    return {rates_[k], end};
+}
+
+SessionArrivals::SessionArrivals(double rate,
+				 const TimeOfDay& open,
+				 const TimeOfDay& close,
+				 const TimeZoneName& tzname,
+				 const Dates& holidays,
+				 BusinessCalendar::WeekdayMask mask)
+    : rate_(rate)
+    , open_(open.to_duration())
+    , close_(close.to_duration())
+    , tz_(Date::locate_timezone(tzname))
+    , holidays_(holidays)
+    , mask_(mask) {
+    if (not (rate > 0))
+	throw core::runtime_error("SessionArrivals: rate must be positive: {}", rate);
+    if (close_ <= open_)
+	throw core::runtime_error("SessionArrivals: session must close after it opens");
+    if ((mask_ & 0x7f) == 0)
+	throw core::runtime_error("SessionArrivals: mask has no weekdays");
+    std::sort(holidays_.begin(), holidays_.end());
+}
+
+bool SessionArrivals::is_business_day(const Date& date) const {
+    auto weekday = date::weekday{date::sys_days{date}}.c_encoding();
+    return ((mask_ >> weekday) & 1) and
+	not std::binary_search(holidays_.begin(), holidays_.end(), date);
+}
+
+std::pair<double, TimePoint> SessionArrivals::segment(const TimePoint& tp) const {
+    auto day = date::floor<date::days>(to_local(tz_, tp));
+    auto next_day = end_after(tz_, day + date::days{1}, tp);
+    if (not is_business_day(Date{date::sys_days{day.time_since_epoch()}}))
+	return {0.0, next_day};
+
+    auto open = to_sys(tz_, day + open_);
+    if (tp < open)
+	return {0.0, open};
+    auto close = to_sys(tz_, day + close_);
+    if (tp < close)
+	return {rate_, close};
+    return {0.0, next_day};
+}
+
+}; // core::chrono
@@ -0,0 +1,86 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include <algorithm>
+#include <thread>
+#include "core/chrono/asof_join.h"
+
+namespace core::chrono
+{
+
+namespace {
+
+// Return the index of the first element of `right` after `key` given that every element
+// before `j` is at or before `key`.
+std::size_t gallop(std::span<const TimePoint> right, std::size_t j, const TimePoint& key) {
+    if (j == right.size() or right[j] > key)
+	return j;
+
+    std::size_t step{1};
+    while (j + step < right.size() and right[j + step] <= key)
+	step *= 2;
+    auto first = right.begin() + j + step / 2 + 1;
+    auto last = right.begin() + std::min(j + step, right.size());
+    return std::upper_bound(first, last, key) - right.begin();
+}
+
+void join_range(std::span<const TimePoint> left,
+		std::span<const TimePoint> right,
+		nanos tolerance,
+		std::size_t begin,
+		std::size_t end,
+		std::vector<AsofPair>& output) {
+    if (begin == end)
+	return;
+
+    auto j = std::size_t(std::upper_bound(right.begin(), right.end(), left[begin])
+			 - right.begin());
+    for (auto i = begin; i < end; ++i) {
+	j = gallop(right, j, left[i]);
+	if (j > 0 and left[i] - right[j - 1] <= tolerance)
+	    output.emplace_back(i, j - 1);
+    }
+}
+
+}; // anonymous
+
+std::vector<AsofPair> asof_join(std::span<const TimePoint> left,
+				std::span<const TimePoint> right,
+				nanos tolerance,
+				unsigned threads) {
+    // Splitting only pays once each thread has a reasonable amount of work.
+    constexpr std::size_t MinimumPerThread = 16 * 1024;
+    threads = std::max(1u, std::min<unsigned>(threads, left.size() / MinimumPerThread));
+
+    std::vector<std::vector<AsofPair>> outputs(threads);
+    auto chunk = (left.size() + threads - 1) / threads;
+    auto run = [&](unsigned t) {
+	auto begin = std::min(left.size(), t * chunk);
+	auto end = std::min(left.size(), begin + chunk);
+	outputs[t].reserve(end - begin);
+	join_range(left, right, tolerance, begin, end, outputs[t]);
+    };
+
+    if (threads == 1) {
+	run(0);
+	return std::move(outputs[0]);
+    }
+
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; ++t)
+	workers.emplace_back(run, t);
+    run(0);
+    for (auto& worker : workers)
+	worker.join();
+
+    std::size_t total{0};
+    for (const auto& output : outputs)
+	total += output.size();
+    std::vector<AsofPair> result;
+    result.reserve(total);
+    for (const auto& output : outputs)
+	result.insert(result.end(), output.begin(), output.end());
+    return result;
+}
+
+}; // core::chrono
@@ -0,0 +1,107 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include "core/chrono/business_calendar.h"
+#include "core/util/json.h"
+
+namespace core::chrono
+{
+
+BusinessCalendar::BusinessCalendar(int first_year,
+				   int last_year,
+				   const Dates& holidays,
+				   WeekdayMask mask) {
+    if (last_year < first_year)
+	throw core::runtime_error("BusinessCalendar: invalid year range {} to {}",
+				  first_year, last_year);
+
+    auto first = date::sys_days{Date{first_year, 1, 1}};
+    auto end = date::sys_days{Date{last_year + 1, 1, 1}};
+    first_ = first.time_since_epoch().count();
+    size_ = (end - first).count();
+    words_.assign(size_ / 64 + 1, 0);
+
+    auto wd = date::weekday{first}.c_encoding();
+    for (std::int64_t n = 0; n < size_; ++n, wd = (wd + 1) % 7)
+	if (mask & (1u << wd))
+	    words_[n >> 6] |= std::uint64_t{1} << (n & 63);
+
+    for (const auto& holiday : holidays)
+	if (contains(holiday)) {
+	    auto n = offset(holiday);
+	    words_[n >> 6] &= ~(std::uint64_t{1} << (n & 63));
+	}
+
+    index();
+}
+
+Date BusinessCalendar::first() const {
+    return at(0);
+}
+
+Date BusinessCalendar::last() const {
+    return at(size_ - 1);
+}
+
+Date BusinessCalendar::add_business_days(const Date& date, std::int64_t n) const {
+    auto offset = checked_offset(date);
+    auto index = n > 0 ? rank(offset) + test(offset) + n - 1 : rank(offset) + n;
+    if (index < 0 or index >= std::int64_t(select_.size()))
+	throw core::runtime_error("BusinessCalendar: {} business days from {} is outside "
+				  "the calendar", n, date);
+    return at(select_[index]);
+}
+
+BusinessCalendar BusinessCalendar::operator&(const BusinessCalendar& other) const {
+    if (first_ != other.first_ or size_ != other.size_)
+	throw core::runtime_error("BusinessCalendar: cannot combine calendars with "
+				  "different ranges");
+    BusinessCalendar result{*this};
+    for (std::size_t i = 0; i < words_.size(); ++i)
+	result.words_[i] &= other.words_[i];
+    result.index();
+    return result;
+}
+
+BusinessCalendar BusinessCalendar::operator|(const BusinessCalendar& other) const {
+    if (first_ != other.first_ or size_ != other.size_)
+	throw core::runtime_error("BusinessCalendar: cannot combine calendars with "
+				  "different ranges");
+    BusinessCalendar result{*this};
+    for (std::size_t i = 0; i < words_.size(); ++i)
+	result.words_[i] |= other.words_[i];
+    result.index();
+    return result;
+}
+
+std::int64_t BusinessCalendar::checked_offset(const Date& date) const {
+    auto n = offset(date);
+    if (n < 0 or n >= size_)
+	throw core::runtime_error("BusinessCalendar: {} is outside the calendar", date);
+    return n;
+}
+
+std::int64_t BusinessCalendar::checked_bound(const Date& date) const {
+    auto n = offset(date);
+    if (n < 0 or n > size_)
+	throw core::runtime_error("BusinessCalendar: {} is outside the calendar", date);
+    return n;
+}
+
+void BusinessCalendar::index() {
+    rank_.resize(words_.size());
+    select_.clear();
+    std::uint32_t total{0};
+    for (std::size_t i = 0; i < words_.size(); ++i) {
+	rank_[i] = total;
+	for (auto bits = words_[i]; bits; bits &= bits - 1)
+	    select_.push_back(64 * i + std::countr_zero(bits));
+	total += std::popcount(words_[i]);
+    }
+}
+
+Date BusinessCalendar::at(std::int64_t n) const {
+    return Date{date::sys_days{date::days{first_ + n}}};
+}
+
+}; // core::chrono
@@ -37,18 +37,34 @@ const date::time_zone *Date::locate_timezone(const std::string& tzname) {
     return tz;
 }
 
-Date Date::min() {
-    return Date{date::year::min(), date::month{1}, date::day{1}};
-}
-
-Date Date::max() {
-    return Date{date::year::max(), date::month{12}, date::day{31}};
-}
-
-Date::Date(const TimePoint& tp, const TimeZoneName& tzname) {
-    auto zone = locate_timezone(tzname);
-    auto zoned_time = date::zoned_time{zone, tp};
-    *this = date::floor<std::chrono::days>(zoned_time.get_sys_time());
+FixedOffset::FixedOffset(std::string_view str) {
+    if (str == "Z")
+	return;
+    auto digit = [&](std::size_t i) {
+	if (i >= str.size() or str[i] < '0' or str[i] > '9')
+	    throw core::runtime_error("FixedOffset: expected [+-]HH[[:]MM]: {}", str);
+	return str[i] - '0';
+    };
+    if (str.empty() or (str[0] != '+' and str[0] != '-'))
+	throw core::runtime_error("FixedOffset: expected [+-]HH[[:]MM]: {}", str);
+    auto hours = 10 * digit(1) + digit(2);
+    std::size_t pos = str.size() > 3 and str[3] == ':' ? 4 : 3;
+    auto minutes = pos < str.size() ? 10 * digit(pos) + digit(pos + 1) : 0;
+    if (pos < str.size() and pos + 2 != str.size())
+	throw core::runtime_error("FixedOffset: expected [+-]HH[[:]MM]: {}", str);
+    if (minutes >= 60)
+	throw core::runtime_error("FixedOffset: minutes out of range: {}", str);
+    auto offset = std::chrono::minutes{60 * hours + minutes};
+    *this = FixedOffset{str[0] == '-' ? -offset : offset};
+}
+
+std::string FixedOffset::to_string() const {
+    auto minutes = offset_.count() < 0 ? -offset_.count() : offset_.count();
+    return fmt::format("{}{:02d}:{:02d}", offset_.count() < 0 ? '-' : '+', minutes / 60, minutes % 60);
+}
+
+Date::Date(const TimePoint& tp, const TimeZoneName& tzname)
+    : Date(tp.date(tzname)) {
 }
 
 Date::Date(std::int64_t nanos, const TimeZoneName& tzname)
@@ -71,53 +87,8 @@ Date::Date(const std::string& date_str, const std::string& fmt) {
 	    ("error: failed to parse date '{}' using format '{}'", date_str, fmt);
 }
 
-TimePoint Date::to_timepoint(const TimeZoneName& tzname) {
-    auto tz = locate_timezone(tzname);
-    auto zt = date::zoned_time{ tz, (date::local_days)*this };
-    return zt.get_sys_time();
-}
-
-double Date::unix_ts() const {
-    return TimePoint{*this}.unix_ts();
-}
-
-Date Date::tomorrow() const {
-    return *this + days{1};
-}
-
-Date Date::yesterday() const {
-    return *this - days{1};
-}
-
-Date& Date::operator++() {
-    return this->operator+=(std::chrono::days{1});
-}
-
-Date& Date::operator--() {
-    return this->operator+=(std::chrono::days{-1});
-}
-
-Date& Date::operator+=(std::chrono::days duration) {
-    *this = date::sys_days(*this) + duration;
-    return *this;
-}
-
-Date Date::operator+(std::chrono::days duration) const {
-    Date date{*this};
-    return date += duration;
-}
-
-Date& Date::operator-=(std::chrono::days duration) {
-    return this->operator+=(-duration);
-}
-
-Date Date::operator-(std::chrono::days duration) const {
-    Date date{*this};
-    return date-=(duration);
-}
-
-std::chrono::days Date::operator-(Date other) const {
-    return date::sys_days(*this) - date::sys_days(other);
+TimePoint Date::to_timepoint(const TimeZoneName& tzname) const {
+    return TimePoint{*this, tzname};
 }
 
 void to_json(json& j, const Date& date) {
@@ -0,0 +1,33 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include "core/chrono/date_range.h"
+#include "core/util/json.h"
+
+namespace core::chrono
+{
+
+DateRange::DateRange(const Date& begin, const Date& end, Step step, int stride)
+    : origin_(date::sys_days{begin}.time_since_epoch().count())
+    , stride_(step == Step::Weeks ? 7 * stride : stride)
+    , step_(step) {
+    if (stride <= 0)
+	throw core::runtime_error("DateRange: stride must be positive: {}", stride);
+    if (end <= begin)
+	return;
+
+    if (step_ != Step::Months) {
+	auto span = (end - begin).count();
+	size_ = (span + stride_ - 1) / stride_;
+	return;
+    }
+
+    auto months = 12 * (int(end.year()) - int(begin.year()))
+	+ (int(unsigned(end.month())) - int(unsigned(begin.month())));
+    size_ = months / stride_ + 1;
+    auto first = this->begin();
+    while (size_ > 0 and first[size_ - 1] >= end)
+	--size_;
+}
+
+}; // core::chrono
@@ -9,7 +9,7 @@ Generator<chron::Date> Sampler<core::chrono::Date>::operator()
     (chron::Date start, chron::Date end) const {
     auto sday = std::chrono::sys_days(start).time_since_epoch().count();
     auto eday = std::chrono::sys_days(end).time_since_epoch().count();
-    auto dist = std::uniform_int_distribution<int>(0, eday - sday);
+    auto dist = std::uniform_int_distribution<std::int64_t>(0, eday - sday);
     while (true) {
 	auto n = dist(core::rng());
 	chron::Date date{date::sys_days(start) + std::chrono::days{n}};
@@ -18,4 +18,18 @@ Generator<chron::Date> Sampler<core::chrono::Date>::operator()
     co_return;
 }
 
+void Sampler<core::chrono::Date>::fill(std::span<chron::Date> out,
+				       chron::Date start,
+				       chron::Date end,
+				       std::uint64_t seed,
+				       std::uint64_t index) {
+    auto sday = std::chrono::sys_days(start).time_since_epoch().count();
+    auto eday = std::chrono::sys_days(end).time_since_epoch().count();
+    core::chrono::CounterRng rng{seed};
+    for (std::size_t i = 0; i < out.size(); ++i) {
+	auto n = rng.between(index + i, sday, eday);
+	out[i] = chron::Date{date::sys_days{std::chrono::days{n}}};
+    }
+}
+
 }; // coro
@@ -0,0 +1,69 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "core/chrono/day_boundaries.h"
+
+namespace core::chrono
+{
+
+const DayBoundaries& DayBoundaries::of(const TimeZoneName& tzname) {
+    // Each thread remembers the tables it has used so the shared registry is only
+    // consulted the first time a thread sees a given name.
+    thread_local std::vector<std::pair<std::string, const DayBoundaries*>> cache;
+    for (const auto& [name, table] : cache)
+	if (name == tzname)
+	    return *table;
+
+    static std::mutex mutex;
+    static std::map<std::string, const DayBoundaries*> by_name;
+    static std::map<const date::time_zone*, std::unique_ptr<DayBoundaries>> by_zone;
+
+    std::lock_guard lock(mutex);
+    auto& table = by_name[tzname];
+    if (table == nullptr) {
+	// Aliases such as `EST` resolve to the same zone and share its table.
+	auto tz = Date::locate_timezone(tzname);
+	auto& entry = by_zone[tz];
+	if (entry == nullptr)
+	    entry = std::make_unique<DayBoundaries>(tz);
+	table = entry.get();
+    }
+    cache.emplace_back(tzname, table);
+    return *table;
+}
+
+DayBoundaries::DayBoundaries(const date::time_zone *tz)
+    : tz_(tz) {
+}
+
+DayBoundaries::~DayBoundaries() {
+    for (auto& chunk : chunks_)
+	delete[] chunk.load(std::memory_order_relaxed);
+}
+
+std::int64_t DayBoundaries::compute(std::int64_t serial) const {
+    auto local = date::local_days{date::days{serial}};
+    auto sys = tz_->to_sys(local, date::choose::earliest);
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(sys.time_since_epoch()).count();
+}
+
+const std::int64_t *DayBoundaries::fill(std::int64_t index) const {
+    auto chunk = new std::int64_t[ChunkSize];
+    auto first = FirstSerial + index * ChunkSize;
+    for (auto i = 0; i < ChunkSize; ++i)
+	chunk[i] = compute(first + i);
+
+    // Another thread may have filled the same chunk concurrently, in which case its
+    // (identical) values are used and ours are discarded.
+    const std::int64_t *expected{nullptr};
+    if (chunks_[index].compare_exchange_strong(expected, chunk, std::memory_order_acq_rel))
+	return chunk;
+    delete[] chunk;
+    return expected;
+}
+
+}; // core::chrono
@@ -0,0 +1,107 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include <cmath>
+#include <fstream>
+#include <fmt/format.h>
+#include "core/chrono/latency_histogram.h"
+
+namespace core::chrono
+{
+
+static const double Percentiles[] = { 50.0, 90.0, 99.0, 99.9, 99.99 };
+
+LatencyHistogram::LatencyHistogram(nanos highest, int precision)
+    : precision_(std::clamp(precision, 1, 16)) {
+    auto value = static_cast<std::uint64_t>(std::max<std::int64_t>(highest.count(), 1));
+    counts_.resize(index_of(value) + 1);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    if (other.precision_ != precision_ or other.counts_.size() != counts_.size())
+	throw core::runtime_error("LatencyHistogram: cannot merge histograms with different "
+				  "configurations");
+    for (std::size_t i = 0; i < counts_.size(); ++i)
+	counts_[i] += other.counts_[i];
+    count_ += other.count_;
+    sum_ += other.sum_;
+    min_ = std::min(min_, other.min_);
+    max_ = std::max(max_, other.max_);
+}
+
+void LatencyHistogram::reset() {
+    std::fill(counts_.begin(), counts_.end(), 0);
+    count_ = sum_ = max_ = 0;
+    min_ = std::numeric_limits<std::uint64_t>::max();
+}
+
+nanos LatencyHistogram::percentile(double p) const {
+    if (count_ == 0)
+	return nanos{0};
+
+    auto rank = static_cast<std::uint64_t>(std::ceil(std::clamp(p, 0.0, 100.0) / 100.0 * count_));
+    rank = std::max<std::uint64_t>(rank, 1);
+
+    std::uint64_t total{0};
+    for (std::size_t i = 0; i < counts_.size(); ++i) {
+	total += counts_[i];
+	if (total >= rank) {
+	    auto value = i + 1 < counts_.size() ? value_of(i + 1) - 1 : max_;
+	    return nanos(std::clamp(value, min_, max_));
+	}
+    }
+    return nanos(max_);
+}
+
+void LatencyHistogram::save(const std::string& path) const {
+    std::ofstream ofs{path};
+    if (not ofs.good())
+	throw core::runtime_error("LatencyHistogram: failed to open {}", path);
+    if (path.ends_with(".json")) {
+	json j = *this;
+	ofs << j.dump(2) << std::endl;
+    } else {
+	ofs << *this;
+    }
+}
+
+std::ostream& operator<<(std::ostream& os, const LatencyHistogram& histogram) {
+    os << fmt::format("count {} mean {:.1f}ns min {}ns", histogram.count(), histogram.mean(),
+		      histogram.min().count());
+    for (auto p : Percentiles)
+	os << fmt::format(" p{} {}ns", p, histogram.percentile(p).count());
+    os << fmt::format(" max {}ns", histogram.max().count()) << std::endl;
+
+    std::uint64_t total{0};
+    for (std::size_t i = 0; i < histogram.size(); ++i) {
+	if (auto count = histogram.count_at(i); count > 0) {
+	    total += count;
+	    os << fmt::format("{:>16} {:>12} {:>8.4f}\n", histogram.value_of(i), count,
+			      100.0 * total / histogram.count());
+	}
+    }
+    return os;
+}
+
+void to_json(json& j, const LatencyHistogram& histogram) {
+    j = json::object();
+    j["count"] = histogram.count();
+    j["min"] = histogram.min().count();
+    j["max"] = histogram.max().count();
+    j["mean"] = histogram.mean();
+    j["precision"] = histogram.precision();
+    j["highest"] = histogram.highest().count();
+
+    json percentiles = json::object();
+    for (auto p : Percentiles)
+	percentiles[fmt::format("{}", p)] = histogram.percentile(p).count();
+    j["percentiles"] = percentiles;
+
+    json buckets = json::array();
+    for (std::size_t i = 0; i < histogram.size(); ++i)
+	if (auto count = histogram.count_at(i); count > 0)
+	    buckets.push_back(json::array({histogram.value_of(i), count}));
+    j["buckets"] = buckets;
+}
+
+}; // core::chrono
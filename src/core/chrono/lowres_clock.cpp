@@ -2,6 +2,7 @@
 //
 
 #include "core/chrono/lowres_clock.h"
+#include "core/chrono/day_boundaries.h"
 
 namespace core::chrono {
 
@@ -21,13 +22,57 @@ LowResClock::LowResClock(Mode mode, chron::nanos resolution)
 	while (not done_) {
 	    auto next = now_.load(std::memory_order_acquire) + resolution_;
 	    std::this_thread::sleep_until(next);
-	    now_ = now_.load(std::memory_order_acquire) + resolution_;
-	    if (mode_ == Mode::RealTime)
-		virtual_now_ = now_.load(std::memory_order_acquire);
+	    tick();
 	}
     });
 }
 
+void LowResClock::tick() {
+    std::lock_guard lock(mutex_);
+    auto now = now_.load(std::memory_order_acquire) + resolution_;
+
+    // The calendars are advanced before the time is published so a reader that sees the
+    // new time also sees the new day.
+    for (std::size_t i = 0; i < tables_.size(); ++i)
+	calendars_[i]->update(now);
+    now_.store(now, std::memory_order_release);
+    if (mode_ == Mode::RealTime)
+	virtual_now_ = now;
+}
+
+LowResClock::ZoneIndex LowResClock::add_zone(const TimeZoneName& tzname) {
+    const auto *table = &DayBoundaries::of(tzname);
+    std::lock_guard lock(mutex_);
+    for (std::size_t i = 0; i < tables_.size(); ++i)
+	if (tables_[i] == table)
+	    return i;
+    if (tables_.size() == MaxZones)
+	throw core::runtime_error("LowResClock: too many zones: {}", MaxZones);
+    calendars_[tables_.size()] = std::make_unique<Calendar>(tzname, now_.load(std::memory_order_acquire));
+    tables_.push_back(table);
+    return tables_.size() - 1;
+}
+
+LowResClock::Calendar::Calendar(const TimeZoneName& tzname, TimePoint now)
+    : table_(&DayBoundaries::of(tzname))
+    , day_(nullptr) {
+    update(now);
+}
+
+void LowResClock::Calendar::update(TimePoint now) {
+    auto day = day_.load(std::memory_order_relaxed);
+    if (day != nullptr and now < day->end)
+	return;
+
+    auto serial = table_->serial(now.time_since_epoch().count());
+    days_.push_back(std::make_unique<Day>(Day{
+		Date{date::sys_days{date::days{serial}}},
+		TimePoint{table_->start(serial)},
+		TimePoint{table_->start(serial + 1)},
+		day}));
+    day_.store(days_.back().get(), std::memory_order_release);
+}
+
 LowResClock::~LowResClock() {
     done_ = true;
     if (thread_.joinable())
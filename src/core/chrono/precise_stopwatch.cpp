@@ -0,0 +1,53 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <fmt/format.h>
+#include "core/chrono/precise_stopwatch.h"
+
+namespace chron
+{
+
+static double median_of(std::vector<double>& values) {
+    auto n = values.size();
+    auto mid = values.begin() + n / 2;
+    std::nth_element(values.begin(), mid, values.end());
+    if (n % 2 == 1)
+	return *mid;
+    auto lower = *std::max_element(values.begin(), mid);
+    return 0.5 * (lower + *mid);
+}
+
+TrialStats TrialStats::from(std::vector<double> samples) {
+    TrialStats stats;
+    stats.trials = samples.size();
+    if (samples.empty())
+	return stats;
+
+    stats.min = *std::min_element(samples.begin(), samples.end());
+    stats.median = median_of(samples);
+    for (auto& sample : samples)
+	sample = std::abs(sample - stats.median);
+    stats.mad = median_of(samples);
+    return stats;
+}
+
+std::ostream& operator<<(std::ostream& os, const TrialStats& stats) {
+    os << fmt::format("trials {} min {:.1f}ns median {:.1f}ns mad {:.1f}ns",
+		      stats.trials, stats.min, stats.median, stats.mad);
+    return os;
+}
+
+PreciseStopWatch::PreciseStopWatch(int calibration_trials) {
+    auto overhead = std::numeric_limits<std::uint64_t>::max();
+    for (auto i = 0; i < std::max(calibration_trials, 1); ++i) {
+	auto begin = core::chrono::TscClock::ticks_begin();
+	auto end = core::chrono::TscClock::ticks_end();
+	overhead = std::min(overhead, end - begin);
+    }
+    overhead_ = overhead;
+}
+
+}; // chron
@@ -0,0 +1,136 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include <algorithm>
+#include "core/chrono/resample.h"
+#include "core/util/json.h"
+
+namespace core::chrono
+{
+
+static constexpr std::int64_t NanosPerDay = 86'400'000'000'000;
+
+static constexpr std::int64_t floor_div(std::int64_t a, std::int64_t b) {
+    auto q = a / b;
+    return q - ((a % b) < 0);
+}
+
+static std::int64_t serial_of(const date::year_month_day& ymd) {
+    return date::sys_days{ymd}.time_since_epoch().count();
+}
+
+Bucketer::Bucketer(nanos width, const TimeZoneName& tzname)
+    : table_(&DayBoundaries::of(tzname))
+    , width_(width.count()) {
+    if (width_ <= 0 or width_ > NanosPerDay)
+	throw core::runtime_error("Bucketer: width must be in (0, 1d]: {}ns", width_);
+}
+
+Bucketer::Bucketer(Period period, const TimeZoneName& tzname)
+    : table_(&DayBoundaries::of(tzname))
+    , period_(period) {
+}
+
+Bucketer::Bucket Bucketer::bucket(const TimePoint& tp) const {
+    auto nanos = tp.time_since_epoch().count();
+    auto serial = table_->serial(nanos);
+
+    if (width_ > 0) {
+	// Allow for days of up to 48 hours so that ids never collide across days.
+	auto slots = (2 * NanosPerDay + width_ - 1) / width_;
+	auto start = table_->start(serial);
+	auto k = (nanos - start) / width_;
+	auto begin = start + k * width_;
+	auto end = std::min(begin + width_, table_->start(serial + 1));
+	return {serial * slots + k, TimePoint{begin}, TimePoint{end}};
+    }
+
+    std::int64_t id, first, last;
+    switch (period_) {
+    case Period::Day:
+	id = serial;
+	first = serial;
+	last = serial + 1;
+	break;
+    case Period::Week:
+	// The epoch is a Thursday, so shifting by three puts Monday at zero.
+	id = floor_div(serial + 3, 7);
+	first = 7 * id - 3;
+	last = first + 7;
+	break;
+    case Period::Month:
+    case Period::Quarter: {
+	date::year_month_day ymd{date::sys_days{date::days{serial}}};
+	auto year = int(ymd.year());
+	auto month = unsigned(ymd.month()) - 1;
+	auto months = period_ == Period::Month ? 1u : 3u;
+	month -= month % months;
+	id = period_ == Period::Month ? 12 * year + month : 4 * year + month / 3;
+	date::year_month begin{date::year{year}, date::month{month + 1}};
+	auto end = begin + date::months{months};
+	first = serial_of(begin / date::day{1});
+	last = serial_of(end / date::day{1});
+	break;
+    }
+    default:
+	throw core::runtime_error("Bucketer: unknown period: {}", int(period_));
+    }
+    return {id, TimePoint{table_->start(first)}, TimePoint{table_->start(last)}};
+}
+
+void Bucketer::bucketize(std::span<const TimePoint> tps, std::span<std::int64_t> ids) const {
+    if (ids.size() < tps.size())
+	throw core::runtime_error("Bucketer: {} ids is too few for {} timepoints",
+				  ids.size(), tps.size());
+
+    // Only compute a new bucket when a timepoint falls outside the current one.
+    Bucket current{0, TimePoint::max(), TimePoint::max()};
+    for (std::size_t i = 0; i < tps.size(); ++i) {
+	if (not current.contains(tps[i]))
+	    current = bucket(tps[i]);
+	ids[i] = current.id;
+    }
+}
+
+std::vector<std::int64_t> Bucketer::bucketize(std::span<const TimePoint> tps) const {
+    std::vector<std::int64_t> ids(tps.size());
+    bucketize(tps, ids);
+    return ids;
+}
+
+std::ostream& operator<<(std::ostream& os, const Bar& bar) {
+    os << bar.bucket.begin << " " << bar.open << " " << bar.high << " " << bar.low << " "
+       << bar.close << " " << bar.sum << " " << bar.count;
+    return os;
+}
+
+std::optional<Bar> Resampler::add(const TimePoint& tp, double value) {
+    std::optional<Bar> completed;
+    if (bar_ and not bar_->bucket.contains(tp)) {
+	if (tp < bar_->bucket.begin)
+	    throw core::runtime_error("Resampler: out of order observation: {} before {}",
+				      tp, bar_->bucket.begin);
+	completed = std::move(bar_);
+	bar_.reset();
+    }
+
+    if (not bar_) {
+	bar_ = Bar{bucketer_.bucket(tp), value, value, value, value, value, 1};
+	return completed;
+    }
+
+    bar_->high = std::max(bar_->high, value);
+    bar_->low = std::min(bar_->low, value);
+    bar_->close = value;
+    bar_->sum += value;
+    ++bar_->count;
+    return completed;
+}
+
+std::optional<Bar> Resampler::flush() {
+    auto completed = std::move(bar_);
+    bar_.reset();
+    return completed;
+}
+
+}; // core::chrono
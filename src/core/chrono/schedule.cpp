@@ -0,0 +1,109 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include <algorithm>
+#include "core/chrono/schedule.h"
+
+namespace core::chrono
+{
+
+// The number of consecutive days without a fire instant after which a schedule is
+// considered exhausted.
+static constexpr int MaxEmptyDays = 2 * 366;
+
+static bool selected(Schedule::WeekdayMask mask, const Date& date) {
+    auto wd = date::weekday{date::sys_days{date}};
+    return mask & (1u << wd.c_encoding());
+}
+
+Schedule::Schedule(Rule rule,
+		   std::vector<TimeOfDay> times,
+		   const TimeZoneName& tzname,
+		   WeekdayMask mask,
+		   TimePoint from)
+    : rule_(rule)
+    , mask_(mask)
+    , cursor_(Date::min())
+    , tzname_(tzname)
+    , times_(std::move(times)) {
+    std::sort(times_.begin(), times_.end());
+    times_.erase(std::unique(times_.begin(), times_.end()), times_.end());
+    rebuild(from);
+}
+
+Schedule Schedule::weekly(WeekdayMask mask,
+			  std::vector<TimeOfDay> times,
+			  const TimeZoneName& tzname,
+			  TimePoint from) {
+    return Schedule{Rule::Weekly, std::move(times), tzname, mask, from};
+}
+
+bool Schedule::matches(const Date& date) const {
+    if (not selected(mask_, date))
+	return false;
+
+    switch (rule_) {
+    case Rule::Weekly:
+	return true;
+    case Rule::FirstBusinessDayOfMonth:
+	for (auto prev = date.yesterday(); prev.month() == date.month(); --prev)
+	    if (selected(mask_, prev))
+		return false;
+	return true;
+    case Rule::LastBusinessDayOfMonth:
+	for (auto next = date.tomorrow(); next.month() == date.month(); ++next)
+	    if (selected(mask_, next))
+		return false;
+	return true;
+    }
+    return false;
+}
+
+void Schedule::advance(TimePoint tp) {
+    while (next_ <= tp and count_ > 0) {
+	if (++head_ == count_)
+	    fill(fires_[count_ - 1]);
+	next_ = count_ > 0 ? fires_[head_] : TimePoint::max();
+    }
+}
+
+void Schedule::rebuild(TimePoint from) {
+    version_ = date::get_tzdb().version;
+    cursor_ = from.date(tzname_);
+    fill(from - nanos{1});
+    next_ = count_ > 0 ? fires_[head_] : TimePoint::max();
+}
+
+bool Schedule::refresh(TimePoint from) {
+    if (date::get_tzdb().version == version_)
+	return false;
+    rebuild(from);
+    return true;
+}
+
+void Schedule::fill(TimePoint after) {
+    head_ = count_ = 0;
+    if (times_.empty())
+	return;
+
+    int empty_days = 0;
+    for (auto date = cursor_; count_ < Depth and empty_days < MaxEmptyDays; ++date) {
+	if (not matches(date)) {
+	    ++empty_days;
+	    continue;
+	}
+	empty_days = 0;
+
+	for (const auto& tod : times_) {
+	    TimePoint tp{date, tod, tzname_};
+	    if (tp <= after)
+		continue;
+	    fires_[count_++] = tp;
+	    cursor_ = date;
+	    if (count_ == Depth)
+		break;
+	}
+    }
+}
+
+}; // core::chrono
@@ -0,0 +1,263 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include <istream>
+#include <map>
+#include <fmt/format.h>
+#include "core/chrono/time_log.h"
+#include "core/util/json.h"
+
+namespace core::chrono
+{
+
+namespace {
+
+constexpr char Magic[] = "ChronTL1";
+constexpr std::size_t MagicSize = sizeof(Magic) - 1;
+
+template<class T>
+void write_value(std::ostream& os, const T& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void write_string(std::ostream& os, char kind, std::uint16_t id, const std::string& str) {
+    os.put(kind);
+    write_value(os, id);
+    write_value(os, std::uint32_t(str.size()));
+    os.write(str.data(), str.size());
+}
+
+template<class T>
+T read_value(std::istream& is) {
+    T value;
+    if (not is.read(reinterpret_cast<char*>(&value), sizeof(T)))
+	throw core::runtime_error("TimeLog: truncated log");
+    return value;
+}
+
+std::string read_string(std::istream& is) {
+    std::string str(read_value<std::uint32_t>(is), '\0');
+    if (not is.read(str.data(), str.size()))
+	throw core::runtime_error("TimeLog: truncated log");
+    return str;
+}
+
+// Write the text line for `record` from thread `tid` with the zone id `zone` of this
+// process and the format `fmt`.
+void render(std::ostream& os,
+	    std::uint32_t tid,
+	    const TimeLog::Record& record,
+	    TimeLog::ZoneId zone,
+	    const std::string& fmt) {
+    ZonedTimePoint ztp{TimePoint{record.nanos}, zone};
+    os << fmt::format("{}\t{}\t{}\n", tid, record.tag, ztp.to_string(fmt));
+}
+
+// Return true if `id` is UTC or a zone registered with **ZonedTimePoint**.
+bool is_registered(TimeLog::ZoneId id) {
+    if (id == 0)
+	return true;
+    try {
+	ZonedTimePoint::zone(id);
+	return true;
+    } catch (const std::exception&) {
+	return false;
+    }
+}
+
+}; // anonymous
+
+TimeLog& TimeLog::instance() {
+    static TimeLog log;
+    return log;
+}
+
+TimeLog::FormatId TimeLog::format_id(const std::string& fmt) {
+    auto& log = instance();
+    std::lock_guard lock{log.mutex_};
+    for (std::size_t i = 0; i < log.formats_.size(); ++i)
+	if (log.formats_[i] == fmt)
+	    return i;
+    if (log.formats_.size() > std::numeric_limits<FormatId>::max())
+	throw core::runtime_error("TimeLog: too many formats");
+    log.formats_.push_back(fmt);
+    return log.formats_.size() - 1;
+}
+
+void TimeLog::decode(std::istream& is, std::ostream& os) {
+    char magic[MagicSize];
+    if (not is.read(magic, MagicSize) or std::string_view{magic, MagicSize} != Magic)
+	throw core::runtime_error("TimeLog: not a binary time log");
+
+    // The zone ids in the log are those of the process that wrote it, so they are mapped
+    // to the ids of this process by name.
+    std::map<FormatId, std::string> formats;
+    std::map<ZoneId, ZoneId> zones{{0, 0}};
+    std::vector<Record> records;
+    for (int kind = is.get(); kind != std::char_traits<char>::eof(); kind = is.get()) {
+	switch (kind) {
+	case 'F': {
+	    auto id = read_value<FormatId>(is);
+	    formats[id] = read_string(is);
+	    break;
+	}
+	case 'Z': {
+	    auto id = read_value<ZoneId>(is);
+	    zones[id] = ZonedTimePoint::zone_id(TimeZoneName{read_string(is)});
+	    break;
+	}
+	case 'R': {
+	    auto tid = read_value<std::uint32_t>(is);
+	    records.resize(read_value<std::uint32_t>(is));
+	    auto bytes = std::streamsize(records.size() * sizeof(Record));
+	    if (not is.read(reinterpret_cast<char*>(records.data()), bytes))
+		throw core::runtime_error("TimeLog: truncated log");
+	    for (const auto& record : records) {
+		auto fiter = formats.find(record.format);
+		if (fiter == formats.end())
+		    throw core::runtime_error("TimeLog: undefined format: {}", record.format);
+		auto ziter = zones.find(record.zone);
+		if (ziter == zones.end())
+		    throw core::runtime_error("TimeLog: undefined zone: {}", record.zone);
+		render(os, tid, record, ziter->second, fiter->second);
+	    }
+	    break;
+	}
+	default:
+	    throw core::runtime_error("TimeLog: unknown block: {}", kind);
+	}
+    }
+}
+
+void TimeLog::start(const std::string& path,
+		    Output output,
+		    chron::nanos interval,
+		    std::size_t capacity) {
+    stop();
+
+    std::scoped_lock lock{flush_mutex_, mutex_};
+    ofs_.open(path, std::ios::binary);
+    if (not ofs_.good())
+	throw core::runtime_error("TimeLog: failed to open {}", path);
+    if (output == Output::Binary)
+	ofs_.write(Magic, MagicSize);
+    output_ = output;
+    formats_written_.clear();
+    zones_written_.clear();
+    capacity_ = capacity;
+    dropped_ = 0;
+    done_ = false;
+    enabled_ = true;
+
+    thread_ = std::thread([this, interval]() {
+	while (not done_) {
+	    std::this_thread::sleep_for(interval);
+	    flush();
+	}
+    });
+}
+
+void TimeLog::stop() {
+    if (not thread_.joinable())
+	return;
+
+    enabled_ = false;
+    done_ = true;
+    thread_.join();
+    flush();
+
+    std::lock_guard lock{flush_mutex_};
+    ofs_.close();
+}
+
+TimeLog::~TimeLog() {
+    stop();
+}
+
+std::shared_ptr<TimeLog::Buffer> TimeLog::attach() {
+    std::lock_guard lock{mutex_};
+    auto buffer = std::make_shared<Buffer>(capacity_, ++next_tid_);
+    buffers_.push_back(buffer);
+    return buffer;
+}
+
+void TimeLog::flush() {
+    std::lock_guard flush_lock{flush_mutex_};
+    {
+	// Only copy the list of rings while holding the registry lock.
+	std::lock_guard lock{mutex_};
+	flush_buffers_ = buffers_;
+    }
+
+    for (auto& buffer : flush_buffers_) {
+	batch_.clear();
+	buffer->ring.consume([&](const Record& record) { batch_.push_back(record); });
+	if (batch_.empty())
+	    continue;
+
+	// An unknown zone id would throw on this thread, so it is rendered as UTC instead.
+	for (auto& record : batch_)
+	    if (record.zone >= zones_registered_.size() or not zones_registered_[record.zone]) {
+		if (is_registered(record.zone)) {
+		    if (record.zone >= zones_registered_.size())
+			zones_registered_.resize(record.zone + 1);
+		    zones_registered_[record.zone] = true;
+		} else {
+		    record.zone = 0;
+		}
+	    }
+
+	if (output_ == Output::Text)
+	    write_text(buffer->tid, batch_);
+	else
+	    write_binary(buffer->tid, batch_);
+    }
+    ofs_.flush();
+    flush_buffers_.clear();
+
+    // Release the rings of threads that have exited once they have been drained.
+    std::lock_guard lock{mutex_};
+    std::erase_if(buffers_, [](const auto& buffer) {
+	return buffer.use_count() == 1 and buffer->ring.empty();
+    });
+}
+
+const std::string& TimeLog::flush_format(FormatId id) {
+    static const std::string unknown{"?"};
+    if (id >= flush_formats_.size()) {
+	std::lock_guard lock{mutex_};
+	flush_formats_ = formats_;
+    }
+    return id < flush_formats_.size() ? flush_formats_[id] : unknown;
+}
+
+void TimeLog::write_text(std::uint32_t tid, const std::vector<Record>& records) {
+    for (const auto& record : records)
+	render(ofs_, tid, record, record.zone, flush_format(record.format));
+}
+
+void TimeLog::write_binary(std::uint32_t tid, const std::vector<Record>& records) {
+    // Define each format and zone before the first batch that uses it.
+    for (const auto& record : records) {
+	if (record.format >= formats_written_.size())
+	    formats_written_.resize(record.format + 1);
+	if (not formats_written_[record.format]) {
+	    write_string(ofs_, 'F', record.format, flush_format(record.format));
+	    formats_written_[record.format] = true;
+	}
+
+	if (record.zone >= zones_written_.size())
+	    zones_written_.resize(record.zone + 1);
+	if (record.zone != 0 and not zones_written_[record.zone]) {
+	    write_string(ofs_, 'Z', record.zone, ZonedTimePoint::zone(record.zone)->name());
+	    zones_written_[record.zone] = true;
+	}
+    }
+
+    ofs_.put('R');
+    write_value(ofs_, tid);
+    write_value(ofs_, std::uint32_t(records.size()));
+    ofs_.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(Record));
+}
+
+}; // core::chrono
@@ -17,22 +17,6 @@ bool operator==(const std::chrono::hh_mm_ss<chron::nanos>& a,
 namespace core::chrono
 {
 
-TimeOfDay TimeOfDay::min() {
-    return TimeOfDay{nanos{0}};
-}
-
-TimeOfDay TimeOfDay::max() {
-    return TimeOfDay{nanos{24 * 60 * 60 * 1'000'000'000ll - 1}};
-}
-
-TimeOfDay::TimeOfDay(const TimeOfDayBase& base)
-    : TimeOfDayBase(base) {
-}
-
-TimeOfDay::TimeOfDay(int hours, int minutes, int seconds, std::int64_t ns)
-    : TimeOfDayBase(nanos{ns + 1'000'000'000ll * (seconds + 60 * (minutes + 60 * hours))}) {
-}
-
 std::string_view maybe_consume_to(const char*& ptr, const char *end, char delimeter) {
     const char *begin = ptr;
     while (ptr < end and *ptr != delimeter)
@@ -19,4 +19,16 @@ Generator<chron::TimeOfDay> Sampler<chron::TimeOfDay>::operator()
     co_return;
 }
 
+void Sampler<chron::TimeOfDay>::fill(std::span<chron::TimeOfDay> out,
+				     chron::TimeOfDay start,
+				     chron::TimeOfDay end,
+				     std::uint64_t seed,
+				     std::uint64_t index) {
+    auto sns = start.to_duration().count();
+    auto ens = end.to_duration().count();
+    core::chrono::CounterRng rng{seed};
+    for (std::size_t i = 0; i < out.size(); ++i)
+	out[i] = chron::TimeOfDay{chron::nanos{rng.between(index + i, sns, ens)}};
+}
+
 }; // coro
@@ -1,7 +1,9 @@
 // Copyright (C) 2021, 2022 by Mark Melton
 //
 
+#include <sstream>
 #include "core/chrono/timepoint.h"
+#include "core/chrono/day_boundaries.h"
 #include "core/string/lexical_cast.h"
 
 namespace core::chrono
@@ -12,34 +14,17 @@ std::ostream& operator<<(std::ostream& os, const TimePoint& tp) {
     return os;
 }
 
-TimePoint TimePoint::epoch() {
-    return TimePoint{std::chrono::nanoseconds{0}};
-}
-    
 TimePoint TimePoint::now() {
     return TimePoint{std::chrono::system_clock::now()};
 }
     
-TimePoint TimePoint::max() {
-    return TimePoint{std::chrono::nanoseconds{std::numeric_limits<std::int64_t>::max()}};
-}
-
-TimePoint::TimePoint(const TimePointBase& base)
-    : TimePointBase(base) {
-}
-
-TimePoint::TimePoint(std::int64_t nanos)
-    : TimePointBase(std::chrono::nanoseconds{nanos}) {
-}
-
-TimePoint::TimePoint(double ts)
-    : TimePointBase(std::chrono::nanoseconds{std::int64_t(1e9 * ts)}) {
-}
-
 TimePoint::TimePoint(const Date& date, const TimeZoneName& tzname) {
-    auto tz = Date::locate_timezone(tzname);
-    auto zt = date::zoned_time{tz, (date::local_days)date};
-    *this = zt.get_sys_time();
+    if (tzname.is_utc()) {
+	*this = TimePoint{date, Utc{}};
+	return;
+    }
+    auto serial = date::sys_days{date}.time_since_epoch().count();
+    *this = TimePoint{DayBoundaries::of(tzname).start(serial)};
 }
 
 TimePoint::TimePoint(const Date& date, const TimeOfDay& tod, const TimeZoneName& tzname)
@@ -65,43 +50,68 @@ TimePoint::TimePoint(const std::string& str, const TimeZoneName& tzname, const s
 }
 
 std::string TimePoint::to_string(const TimeZoneName& tzname, const std::string& fmt) const {
+    if (tzname.is_utc())
+	return to_string(Utc{}, fmt);
     auto tz = Date::locate_timezone(tzname);
     auto zt = date::zoned_time{tz, *this};
     return date::format(fmt, zt);
 }
 
+std::string TimePoint::to_string(Utc, const std::string& fmt) const {
+    return date::format(fmt, static_cast<const TimePointBase&>(*this));
+}
+
+std::string TimePoint::to_string(FixedOffset offset, const std::string& fmt) const {
+    auto abbrev = offset.to_string();
+    std::chrono::seconds offset_seconds{offset.offset()};
+    date::local_time<std::chrono::nanoseconds> local{time_since_epoch() + offset.offset()};
+    std::ostringstream ss;
+    date::to_stream(ss, fmt.c_str(), local, &abbrev, &offset_seconds);
+    return ss.str();
+}
+
 Date TimePoint::date(const TimeZoneName& tzname) const {
-    auto tz = Date::locate_timezone(tzname);
-    auto zt = date::zoned_time{tz, *this};
-    return Date{date::floor<date::days>(zt.get_local_time())};
+    if (tzname.is_utc())
+	return date(Utc{});
+    const auto& table = DayBoundaries::of(tzname);
+    auto serial = table.serial(time_since_epoch().count());
+    return Date{date::sys_days{date::days{serial}}};
 }
 
 TimeOfDay TimePoint::time_of_day(const TimeZoneName& tzname) const {
-    auto interval = *this - midnight(tzname);
-    return TimeOfDay{interval};
+    if (tzname.is_utc())
+	return time_of_day(Utc{});
+    const auto& table = DayBoundaries::of(tzname);
+    auto nanos = time_since_epoch().count();
+    auto serial = table.serial(nanos);
+    return TimeOfDay{std::chrono::nanoseconds{nanos - table.start(serial)}};
 }
 
 std::pair<Date,TimeOfDay> TimePoint::components(const TimeZoneName& tzname) const {
-    Date d = date(tzname);
-    auto tz = Date::locate_timezone(tzname);
-    auto zt = date::zoned_time{tz, (date::local_days)d};
-    auto interval = *this - zt.get_sys_time();
-    TimeOfDay tod{interval};
+    if (tzname.is_utc())
+	return components(Utc{});
+    const auto& table = DayBoundaries::of(tzname);
+    auto nanos = time_since_epoch().count();
+    auto serial = table.serial(nanos);
+    Date d{date::sys_days{date::days{serial}}};
+    TimeOfDay tod{std::chrono::nanoseconds{nanos - table.start(serial)}};
     return {d, tod};
 }
 
 TimePoint TimePoint::midnight(const TimeZoneName& tzname) const {
-    return TimePoint{date(tzname), tzname};
+    if (tzname.is_utc())
+	return midnight(Utc{});
+    const auto& table = DayBoundaries::of(tzname);
+    auto serial = table.serial(time_since_epoch().count());
+    return TimePoint{table.start(serial)};
 }
 
 TimePoint TimePoint::next_midnight(const TimeZoneName& tzname) const {
-    auto d = date(tzname);
-    ++d;
-    return TimePoint{d, tzname};
-}
-
-double TimePoint::unix_ts() const {
-    return 1e-9 * time_since_epoch().count();
+    if (tzname.is_utc())
+	return next_midnight(Utc{});
+    const auto& table = DayBoundaries::of(tzname);
+    auto serial = table.serial(time_since_epoch().count());
+    return TimePoint{table.start(serial + 1)};
 }
 
 void to_json(json& j, const TimePoint& tp) {
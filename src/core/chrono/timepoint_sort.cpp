@@ -0,0 +1,139 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include "core/chrono/timepoint_sort.h"
+#include "core/util/json.h"
+
+namespace core::chrono
+{
+
+void radix_sort(std::span<TimePoint> tps) {
+    // Below this size the histogram and buffer setup costs more than a comparison sort.
+    constexpr std::size_t SmallSize = 1024;
+    if (tps.size() <= SmallSize)
+	std::sort(tps.begin(), tps.end());
+    else
+	detail::radix_sort<void>(tps, nullptr);
+}
+
+std::vector<std::uint32_t> radix_argsort(std::span<const TimePoint> tps) {
+    std::vector<TimePoint> keys(tps.begin(), tps.end());
+    std::vector<std::uint32_t> indices(tps.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    detail::radix_sort<std::uint32_t>(keys, indices.data());
+    return indices;
+}
+
+namespace {
+
+// A loser tree over `k` sorted inputs. Node 0 holds the overall winner, nodes 1 through
+// k-1 hold the loser of the match played at that node and the inputs are the implicit
+// leaves k through 2k-1.
+class LoserTree {
+public:
+    LoserTree(std::span<const std::span<const TimePoint>> inputs)
+	: inputs_(inputs)
+	, k_(inputs.size())
+	, heads_(k_)
+	, positions_(k_, 0)
+	, tree_(std::max<std::size_t>(k_, 1)) {
+	for (std::size_t i = 0; i < k_; ++i)
+	    load(i);
+	if (k_ > 0)
+	    tree_[0] = build(1);
+    }
+
+    // Return the input holding the smallest head.
+    std::uint32_t winner() const { return tree_[0]; }
+
+    // Return the smallest head.
+    TimePoint top() const { return TimePoint{heads_[tree_[0]]}; }
+
+    // Advance the winning input and replay its path to the root.
+    void pop() {
+	auto w = tree_[0];
+	++positions_[w];
+	load(w);
+	for (auto node = (w + k_) / 2; node >= 1; node /= 2)
+	    if (less(tree_[node], w))
+		std::swap(tree_[node], w);
+	tree_[0] = w;
+    }
+
+private:
+    void load(std::size_t i) {
+	auto& input = inputs_[i];
+	heads_[i] = positions_[i] < input.size()
+	    ? input[positions_[i]].time_since_epoch().count()
+	    : std::numeric_limits<std::int64_t>::max();
+    }
+
+    bool exhausted(std::uint32_t i) const {
+	return positions_[i] >= inputs_[i].size();
+    }
+
+    bool less(std::uint32_t a, std::uint32_t b) const {
+	if (heads_[a] != heads_[b])
+	    return heads_[a] < heads_[b];
+	// Equal heads can only tie with the sentinel at the maximum representable time.
+	if (exhausted(a) != exhausted(b))
+	    return exhausted(b);
+	return a < b;
+    }
+
+    std::uint32_t build(std::size_t node) {
+	if (node >= k_)
+	    return node - k_;
+	auto a = build(2 * node), b = build(2 * node + 1);
+	if (less(a, b)) {
+	    tree_[node] = b;
+	    return a;
+	}
+	tree_[node] = a;
+	return b;
+    }
+
+    std::span<const std::span<const TimePoint>> inputs_;
+    std::size_t k_;
+    std::vector<std::int64_t> heads_;
+    std::vector<std::size_t> positions_;
+    std::vector<std::uint32_t> tree_;
+};
+
+}; // anonymous
+
+void merge_sorted(std::span<const std::span<const TimePoint>> inputs,
+		  std::span<TimePoint> output,
+		  std::span<std::uint32_t> sources) {
+    std::size_t total{0};
+    for (const auto& input : inputs)
+	total += input.size();
+    if (output.size() != total)
+	throw core::runtime_error("merge_sorted: output size {} does not match input size {}",
+				  output.size(), total);
+    if (sources.size() != 0 and sources.size() != total)
+	throw core::runtime_error("merge_sorted: sources size {} does not match input size {}",
+				  sources.size(), total);
+
+    LoserTree tree{inputs};
+    for (std::size_t i = 0; i < total; ++i) {
+	output[i] = tree.top();
+	if (sources.size())
+	    sources[i] = tree.winner();
+	tree.pop();
+    }
+}
+
+std::vector<TimePoint> merge_sorted(std::span<const std::span<const TimePoint>> inputs) {
+    std::size_t total{0};
+    for (const auto& input : inputs)
+	total += input.size();
+    std::vector<TimePoint> output(total);
+    merge_sorted(inputs, output);
+    return output;
+}
+
+}; // core::chrono
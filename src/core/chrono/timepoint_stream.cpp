@@ -18,4 +18,16 @@ Generator<chron::TimePoint> Sampler<chron::TimePoint>::operator()
     co_return;
 }
 
+void Sampler<chron::TimePoint>::fill(std::span<chron::TimePoint> out,
+				     chron::TimePoint start,
+				     chron::TimePoint end,
+				     std::uint64_t seed,
+				     std::uint64_t index) {
+    auto sns = start.time_since_epoch().count();
+    auto ens = end.time_since_epoch().count();
+    core::chrono::CounterRng rng{seed};
+    for (std::size_t i = 0; i < out.size(); ++i)
+	out[i] = core::chrono::TimePoint{rng.between(index + i, sns, ens)};
+}
+
 }; // coro
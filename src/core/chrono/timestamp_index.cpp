@@ -0,0 +1,216 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "core/chrono/timestamp_index.h"
+#include "core/util/json.h"
+
+namespace core::chrono
+{
+
+namespace {
+
+constexpr char Magic[8] = {'C', 'H', 'R', 'O', 'N', 'I', 'D', 'X'};
+constexpr std::uint32_t Version = 1;
+constexpr std::uint64_t DataOffset = 64;
+
+struct Header {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t max_error;
+    std::uint64_t size;
+    std::uint64_t segments;
+    std::uint64_t data_offset;
+    std::uint64_t segment_offset;
+};
+static_assert(sizeof(Header) <= DataOffset);
+
+// Partition the sorted `keys` into segments such that, within each segment, the line
+// through the first key with the segment slope predicts the index of every key to within
+// `max_error`. Each segment is grown greedily while the cone of feasible slopes is
+// non-empty.
+std::vector<TimestampIndex::Segment> build_segments(std::span<const TimePoint> tps,
+						     std::uint32_t max_error) {
+    std::vector<TimestampIndex::Segment> segments;
+    auto eps = double(max_error);
+    std::size_t i{0};
+    while (i < tps.size()) {
+	auto i0 = i;
+	auto k0 = tps[i0].time_since_epoch().count();
+	auto lo = 0.0, hi = std::numeric_limits<double>::infinity();
+	for (++i; i < tps.size(); ++i) {
+	    auto dk = double(tps[i].time_since_epoch().count()) - double(k0);
+	    auto di = double(i - i0);
+	    if (dk == 0) {
+		if (di > eps)
+		    break;
+		continue;
+	    }
+	    auto new_lo = std::max(lo, (di - eps) / dk);
+	    auto new_hi = std::min(hi, (di + eps) / dk);
+	    if (new_lo > new_hi)
+		break;
+	    lo = new_lo;
+	    hi = new_hi;
+	}
+	auto slope = hi == std::numeric_limits<double>::infinity() ? 0.0 : (lo + hi) / 2;
+	segments.push_back({k0, i0, slope});
+    }
+    return segments;
+}
+
+}; // anonymous
+
+void TimestampIndex::write(const std::string& path,
+			   std::span<const TimePoint> tps,
+			   std::uint32_t max_error) {
+    if (not std::is_sorted(tps.begin(), tps.end()))
+	throw core::runtime_error("TimestampIndex: timestamps for {} are not sorted", path);
+
+    auto segments = build_segments(tps, max_error);
+    Header header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.max_error = max_error;
+    header.size = tps.size();
+    header.segments = segments.size();
+    header.data_offset = DataOffset;
+    header.segment_offset = DataOffset + tps.size() * sizeof(std::int64_t);
+
+    std::ofstream out{path, std::ios::binary | std::ios::trunc};
+    if (not out)
+	throw core::runtime_error("TimestampIndex: failed to create {}", path);
+
+    char padding[DataOffset]{};
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(padding, DataOffset - sizeof(header));
+
+    std::vector<std::int64_t> buffer;
+    constexpr std::size_t ChunkSize = 4096;
+    for (std::size_t i = 0; i < tps.size(); i += ChunkSize) {
+	buffer.clear();
+	for (std::size_t j = i; j < std::min(tps.size(), i + ChunkSize); ++j)
+	    buffer.push_back(tps[j].time_since_epoch().count());
+	out.write(reinterpret_cast<const char*>(buffer.data()),
+		  buffer.size() * sizeof(std::int64_t));
+    }
+    out.write(reinterpret_cast<const char*>(segments.data()),
+	      segments.size() * sizeof(Segment));
+
+    if (not out)
+	throw core::runtime_error("TimestampIndex: failed to write {}", path);
+}
+
+TimestampIndex::TimestampIndex(const std::string& path) {
+    auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+	throw core::runtime_error("TimestampIndex: failed to open {}: {}", path,
+				  std::strerror(errno));
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 or std::size_t(st.st_size) < DataOffset) {
+	::close(fd);
+	throw core::runtime_error("TimestampIndex: {} is not an index file", path);
+    }
+
+    length_ = st.st_size;
+    map_ = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (map_ == MAP_FAILED) {
+	map_ = nullptr;
+	throw core::runtime_error("TimestampIndex: failed to map {}: {}", path,
+				  std::strerror(errno));
+    }
+
+    const auto& header = *reinterpret_cast<const Header*>(map_);
+    auto data_end = header.data_offset + header.size * sizeof(std::int64_t);
+    auto segment_end = header.segment_offset + header.segments * sizeof(Segment);
+    if (std::memcmp(header.magic, Magic, sizeof(Magic)) != 0
+	or header.version != Version
+	or header.data_offset % alignof(std::int64_t) != 0
+	or header.segment_offset % alignof(Segment) != 0
+	or data_end > length_
+	or segment_end > length_
+	or (header.size > 0 and header.segments == 0)) {
+	::munmap(map_, length_);
+	map_ = nullptr;
+	throw core::runtime_error("TimestampIndex: {} is not a valid index file", path);
+    }
+
+    auto base = reinterpret_cast<const char*>(map_);
+    data_ = reinterpret_cast<const std::int64_t*>(base + header.data_offset);
+    size_ = header.size;
+    segment_ = reinterpret_cast<const Segment*>(base + header.segment_offset);
+    segments_ = header.segments;
+    max_error_ = header.max_error;
+}
+
+TimestampIndex::~TimestampIndex() {
+    if (map_)
+	::munmap(map_, length_);
+}
+
+TimestampIndex::TimestampIndex(TimestampIndex&& other) {
+    *this = std::move(other);
+}
+
+TimestampIndex& TimestampIndex::operator=(TimestampIndex&& other) {
+    std::swap(map_, other.map_);
+    std::swap(length_, other.length_);
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(segment_, other.segment_);
+    std::swap(segments_, other.segments_);
+    std::swap(max_error_, other.max_error_);
+    return *this;
+}
+
+std::size_t TimestampIndex::lower_bound(const TimePoint& tp) const {
+    return lower_bound(tp.time_since_epoch().count());
+}
+
+std::size_t TimestampIndex::upper_bound(const TimePoint& tp) const {
+    auto key = tp.time_since_epoch().count();
+    if (key == std::numeric_limits<std::int64_t>::max())
+	return size_;
+    return lower_bound(key + 1);
+}
+
+std::size_t TimestampIndex::lower_bound(std::int64_t key) const {
+    // Every element before the answer is less than `key`, so the last of them belongs to
+    // the last segment starting with a key less than `key`.
+    auto end_segment = segment_ + segments_;
+    auto s = std::partition_point(segment_, end_segment, [&](const Segment& segment) {
+	return segment.key < key;
+    });
+    if (s == segment_)
+	return 0;
+    --s;
+
+    auto first = std::size_t(s->index);
+    auto last = s + 1 == end_segment ? size_ : std::size_t((s + 1)->index);
+    auto predicted = double(first) + s->slope * (double(key) - double(s->key));
+    auto p = std::size_t(std::clamp(predicted, double(first), double(last)));
+
+    // Search the window around the prediction, widening it to the whole segment should
+    // the prediction for a key that is not in the column fall outside the error bound.
+    std::size_t eps = max_error_ + 1;
+    auto lo = p > first + eps ? p - eps : first;
+    auto hi = std::min(last, p + eps + 1);
+    if (lo > first and data_[lo - 1] >= key)
+	lo = first;
+    if (hi < last and data_[hi] < key)
+	hi = last;
+    return std::lower_bound(data_ + lo, data_ + hi, key) - data_;
+}
+
+}; // core::chrono
@@ -0,0 +1,99 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include <unistd.h>
+#include <fmt/format.h>
+#include "core/chrono/trace.h"
+#include "core/util/json.h"
+
+namespace core::chrono
+{
+
+Tracer& Tracer::instance() {
+    static Tracer tracer;
+    return tracer;
+}
+
+std::uint32_t Tracer::name_id(const std::string& name) {
+    auto& tracer = instance();
+    std::lock_guard lock{tracer.mutex_};
+    for (std::size_t i = 0; i < tracer.names_.size(); ++i)
+	if (tracer.names_[i] == name)
+	    return i;
+    tracer.names_.push_back(name);
+    return tracer.names_.size() - 1;
+}
+
+void Tracer::start(const std::string& path, chron::nanos interval, std::size_t capacity) {
+    stop();
+
+    std::lock_guard lock{mutex_};
+    ofs_.open(path);
+    if (not ofs_.good())
+	throw core::runtime_error("Tracer: failed to open {}", path);
+    ofs_ << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    first_ = true;
+    capacity_ = capacity;
+    dropped_ = 0;
+    done_ = false;
+    enabled_ = true;
+
+    thread_ = std::thread([this, interval]() {
+	while (not done_) {
+	    std::this_thread::sleep_for(interval);
+	    flush();
+	}
+    });
+}
+
+void Tracer::stop() {
+    if (not thread_.joinable())
+	return;
+
+    enabled_ = false;
+    done_ = true;
+    thread_.join();
+    flush();
+
+    std::lock_guard lock{mutex_};
+    ofs_ << "\n]}" << std::endl;
+    ofs_.close();
+}
+
+Tracer::~Tracer() {
+    stop();
+}
+
+std::shared_ptr<Tracer::Buffer> Tracer::attach() {
+    std::lock_guard lock{mutex_};
+    auto buffer = std::make_shared<Buffer>(capacity_, ++next_tid_);
+    buffers_.push_back(buffer);
+    return buffer;
+}
+
+void Tracer::flush() {
+    static const auto pid = ::getpid();
+
+    std::lock_guard lock{mutex_};
+    for (auto& buffer : buffers_) {
+	buffer->ring.consume([&](const Event& event) {
+	    // Names are arbitrary strings, so they are quoted and escaped as JSON.
+	    auto name = json(event.name < names_.size() ? names_[event.name] : "?").dump();
+	    ofs_ << fmt::format("{}\n{{\"name\":{},\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},"
+				"\"pid\":{},\"tid\":{}}}",
+				first_ ? "" : ",", name,
+				1e-3 * clock_.to_timepoint(event.begin).time_since_epoch().count(),
+				1e-3 * clock_.to_nanos(event.end - event.begin).count(),
+				pid, buffer->tid);
+	    first_ = false;
+	});
+    }
+    ofs_.flush();
+
+    // Release the rings of threads that have exited once they have been drained.
+    std::erase_if(buffers_, [](const auto& buffer) {
+	return buffer.use_count() == 1 and buffer->ring.empty();
+    });
+}
+
+}; // core::chrono
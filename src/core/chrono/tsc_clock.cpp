@@ -0,0 +1,23 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include <thread>
+#include "core/chrono/tsc_clock.h"
+
+namespace core::chrono {
+
+TscClock::TscClock(chron::nanos interval) {
+    auto t0 = chron::TimePoint::now();
+    auto c0 = ticks();
+    std::this_thread::sleep_for(interval);
+    auto t1 = chron::TimePoint::now();
+    auto c1 = ticks();
+
+    auto elapsed = (t1 - t0).count();
+    auto count = c1 - c0;
+    nanos_per_tick_ = count > 0 ? double(elapsed) / count : 1.0;
+    base_ = t1;
+    base_ticks_ = c1;
+}
+
+}; // core::chrono
@@ -0,0 +1,155 @@
+// Copyright (C) 2022 by Mark Melton
+//
+
+#include <array>
+#include <atomic>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <vector>
+#include "core/chrono/day_boundaries.h"
+#include "core/chrono/zoned_timepoint.h"
+
+namespace core::chrono
+{
+
+namespace {
+
+// The maximum number of distinct zones, which is comfortably more than the number of
+// zones in the timezone database.
+constexpr std::size_t MaxZones = 1024;
+
+struct Registry {
+    std::mutex mutex;
+    std::map<const DayBoundaries*, ZonedTimePoint::ZoneId> ids;
+    std::array<std::atomic<const DayBoundaries*>, MaxZones> tables{};
+    std::atomic<std::size_t> size{1};
+};
+
+Registry& registry() {
+    static Registry registry;
+    return registry;
+}
+
+const DayBoundaries& table(ZonedTimePoint::ZoneId id) {
+    auto& reg = registry();
+    if (id == 0 or id >= reg.size.load(std::memory_order_acquire))
+	throw core::runtime_error("ZonedTimePoint: unknown zone id: {}", id);
+    return *reg.tables[id].load(std::memory_order_acquire);
+}
+
+// The interval of instants (as nanoseconds since the epoch) over which a zone has a
+// given offset in seconds from UTC.
+struct Interval {
+    std::int64_t begin{0}, end{0};
+    std::int32_t offset{0};
+};
+
+std::int64_t saturated_nanos(date::sys_seconds tp) {
+    constexpr auto Limit = std::numeric_limits<std::int64_t>::max() / 1'000'000'000;
+    auto seconds = tp.time_since_epoch().count();
+    if (seconds <= -Limit)
+	return std::numeric_limits<std::int64_t>::min();
+    if (seconds >= Limit)
+	return std::numeric_limits<std::int64_t>::max();
+    return seconds * 1'000'000'000;
+}
+
+}; // anonymous
+
+ZonedTimePoint::ZoneId ZonedTimePoint::zone_id(const TimeZoneName& tzname) {
+    if (tzname.is_utc())
+	return 0;
+
+    // Each thread remembers the names it has used so the shared registry is only
+    // consulted the first time a thread sees a given name.
+    thread_local std::vector<std::pair<std::string, ZoneId>> cache;
+    for (const auto& [name, id] : cache)
+	if (name == tzname)
+	    return id;
+
+    // Aliases such as `EST` share the table (and hence the id) of the zone.
+    auto table = &DayBoundaries::of(tzname);
+    auto& reg = registry();
+    std::lock_guard lock(reg.mutex);
+    auto [iter, inserted] = reg.ids.emplace(table, ZoneId(reg.size.load(std::memory_order_relaxed)));
+    if (inserted) {
+	if (iter->second >= MaxZones) {
+	    reg.ids.erase(iter);
+	    throw core::runtime_error("ZonedTimePoint: too many zones: {}", MaxZones);
+	}
+	reg.tables[iter->second].store(table, std::memory_order_release);
+	reg.size.store(iter->second + 1, std::memory_order_release);
+    }
+    cache.emplace_back(tzname, iter->second);
+    return iter->second;
+}
+
+const date::time_zone *ZonedTimePoint::zone(ZoneId id) {
+    return id == 0 ? nullptr : table(id).zone();
+}
+
+ZonedTimePoint::ZonedTimePoint(const TimePoint& tp, const TimeZoneName& tzname)
+    : ZonedTimePoint(tp, zone_id(tzname)) {
+}
+
+ZonedTimePoint::ZonedTimePoint(const TimePoint& tp, ZoneId id)
+    : nanos_(tp.time_since_epoch().count())
+    , zone_(id) {
+    if (id == 0)
+	return;
+
+    const auto& days = table(id);
+    auto serial = days.serial(nanos_);
+    auto start = days.start(serial);
+    day_offset_ = std::int32_t((serial * NanosPerDay - start) / 1'000'000'000);
+
+    // Consecutive instants in a zone almost always fall between the same pair of
+    // transitions, so each thread remembers the last interval it resolved for each zone.
+    thread_local std::vector<Interval> intervals;
+    if (id >= intervals.size())
+	intervals.resize(id + 1);
+    auto& interval = intervals[id];
+    if (nanos_ < interval.begin or nanos_ >= interval.end) {
+	auto info = days.zone()->get_info(date::sys_time<std::chrono::nanoseconds>{tp.time_since_epoch()});
+	interval.begin = saturated_nanos(info.begin);
+	interval.end = saturated_nanos(info.end);
+	interval.offset = std::int32_t(info.offset.count());
+    }
+    auto skew = interval.offset - day_offset_;
+    if (skew < -16'384 or skew >= 16'384)
+	throw core::runtime_error("ZonedTimePoint: offset changes by {}s within a day", skew);
+    skew_ = std::int16_t(2 * skew + (nanos_ - start >= NanosPerDay));
+}
+
+std::string ZonedTimePoint::zone_name() const {
+    if (zone_ != 0)
+	return zone(zone_)->name();
+    if (day_offset_ == 0)
+	return "UTC";
+    return FixedOffset{std::chrono::minutes{day_offset_ / 60}}.to_string();
+}
+
+std::string ZonedTimePoint::to_string(const std::string& fmt) const {
+    std::string abbrev;
+    if (fmt.find("%Z") != std::string::npos) {
+	if (zone_ == 0)
+	    abbrev = zone_name();
+	else
+	    abbrev = zone(zone_)->get_info(date::sys_time<std::chrono::nanoseconds>
+					   {timepoint().time_since_epoch()}).abbrev;
+    }
+    auto offset = this->offset();
+    date::local_time<std::chrono::nanoseconds> local{timepoint().time_since_epoch() + offset};
+    std::ostringstream ss;
+    date::to_stream(ss, fmt.c_str(), local, &abbrev, &offset);
+    return ss.str();
+}
+
+std::ostream& operator<<(std::ostream& os, const ZonedTimePoint& ztp) {
+    os << ztp.to_string("%F %T ") << ztp.zone_name();
+    return os;
+}
+
+}; // core::chrono
@@ -0,0 +1,160 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <set>
+#include "core/chrono/arrival_stream.h"
+#include "core/chrono/chrono.h"
+
+using namespace chron;
+
+static const std::size_t NumberSamples = 100'000;
+
+static const TimeZoneName NewYork{"America/New_York"};
+
+// Return the mean rate per second of the sorted arrivals `tps` after `start`.
+static double mean_rate(const std::vector<TimePoint>& tps, const TimePoint& start) {
+    return tps.size() / (1e-9 * (tps.back() - start).count());
+}
+
+// Return the variance to mean ratio of the number of arrivals in windows of `width`.
+static double dispersion(const std::vector<TimePoint>& tps, nanos width) {
+    std::vector<double> counts((tps.back() - tps.front()) / width + 1, 0);
+    for (const auto& tp : tps)
+	++counts[(tp - tps.front()) / width];
+    auto mean = std::accumulate(counts.begin(), counts.end(), 0.0) / counts.size();
+    double variance{0};
+    for (auto count : counts)
+	variance += (count - mean) * (count - mean);
+    return variance / counts.size() / mean;
+}
+
+template<class Process>
+void check_determinism(const Process& process, const TimePoint& start) {
+    std::vector<TimePoint> filled(1000), chunked(1000);
+    process.fill(filled, start, 42);
+    EXPECT_TRUE(std::is_sorted(filled.begin(), filled.end()));
+    EXPECT_GE(filled.front(), start);
+
+    auto state = process.begin(start, 42);
+    process.fill(std::span{chunked}.first(300), state);
+    process.fill(std::span{chunked}.subspan(300), state);
+    EXPECT_EQ(chunked, filled);
+
+    auto generator = process(start, 42);
+    for (const auto& tp : filled)
+	EXPECT_EQ(generator.sample(), tp);
+}
+
+TEST(ArrivalStream, Poisson)
+{
+    TimePoint start{jan/2/2024};
+    PoissonArrivals process{1000.0};
+    check_determinism(process, start);
+
+    std::vector<TimePoint> tps(NumberSamples);
+    process.fill(tps, start, 7);
+    EXPECT_NEAR(mean_rate(tps, start), 1000.0, 20.0);
+    EXPECT_NEAR(dispersion(tps, millis{100}), 1.0, 0.2);
+    EXPECT_THROW(PoissonArrivals(0.0), std::runtime_error);
+}
+
+TEST(ArrivalStream, Hawkes)
+{
+    TimePoint start{jan/2/2024};
+    HawkesArrivals process{200.0, 0.8, millis{10}};
+    check_determinism(process, start);
+
+    std::vector<TimePoint> tps(NumberSamples);
+    process.fill(tps, start, 7);
+    EXPECT_NEAR(mean_rate(tps, start), 1000.0, 150.0);
+    EXPECT_GT(dispersion(tps, millis{100}), 3.0);
+    EXPECT_THROW(HawkesArrivals(1.0, 1.0, millis{1}), std::runtime_error);
+}
+
+TEST(ArrivalStream, TimeOfDay)
+{
+    // Hourly rates that are zero overnight and peak at the open and the close.
+    std::vector<double> rates(24, 0.0);
+    rates[9] = 5.0;
+    rates[10] = 1.0;
+    rates[15] = 4.0;
+    TimePoint start{mar/8/2024, NewYork};
+    TimeOfDayArrivals process{rates, NewYork};
+    check_determinism(process, start);
+
+    std::vector<TimePoint> tps(NumberSamples);
+    process.fill(tps, start, 7);
+    // Count the arrivals on the first two (complete) days.
+    std::vector<double> counts(24, 0.0);
+    TimePoint end{mar/10/2024, NewYork};
+    ASSERT_GT(tps.back(), end);
+    for (const auto& tp : tps)
+	if (tp < end)
+	    ++counts[std::stoi(tp.to_string(NewYork, "%H"))];
+    EXPECT_EQ(counts[0] + counts[8] + counts[11] + counts[16], 0);
+    EXPECT_NEAR(counts[9] / counts[15], 5.0 / 4.0, 0.05);
+    EXPECT_NEAR(counts[9] / counts[10], 5.0, 0.3);
+}
+
+TEST(ArrivalStream, TimeOfDayFallBack)
+{
+    // Per-minute rates that double during the 1 o'clock hour, which occurs twice on the
+    // day the clocks fall back.
+    std::vector<double> rates(1440, 1.0);
+    std::fill(rates.begin() + 60, rates.begin() + 120, 2.0);
+    TimeOfDayArrivals process{rates, NewYork};
+    TimePoint midnight{nov/3/2024, NewYork};
+    check_determinism(process, midnight + hours{2});
+
+    std::vector<TimePoint> tps(NumberSamples);
+    process.fill(tps, midnight, 7);
+    EXPECT_TRUE(std::is_sorted(tps.begin(), tps.end()));
+    ASSERT_GT(tps.back(), midnight + hours{4});
+    auto count = [&](int hour) {
+	auto begin = midnight + hours{hour}, end = begin + hours{1};
+	return std::count_if(tps.begin(), tps.end(), [&](const TimePoint& tp) {
+	    return begin <= tp and tp < end;
+	});
+    };
+    EXPECT_NEAR(count(0), 3600, 300);
+    EXPECT_NEAR(count(1), 7200, 400);
+    EXPECT_NEAR(count(2), 7200, 400);
+    EXPECT_NEAR(count(3), 3600, 300);
+}
+
+TEST(ArrivalStream, Session)
+{
+    TimeOfDay open{9, 30, 0}, close{16, 0, 0};
+    Dates holidays{mar/29/2024};
+    SessionArrivals process{0.1, open, close, NewYork, holidays};
+    TimePoint start{mar/1/2024, NewYork};
+    check_determinism(process, start);
+
+    std::vector<TimePoint> tps(NumberSamples);
+    process.fill(tps, start, 7);
+    std::set<Date> dates;
+    for (const auto& tp : tps) {
+	auto [date, tod] = tp.components(NewYork);
+	dates.insert(date);
+	auto wall = TimePoint{date, open, NewYork} <= tp and tp < TimePoint{date, close, NewYork};
+	ASSERT_TRUE(wall) << tp.to_string(NewYork);
+	ASSERT_TRUE(process.is_business_day(date));
+    }
+    EXPECT_FALSE(dates.contains(mar/29/2024));
+    EXPECT_TRUE(dates.contains(mar/11/2024));
+
+    // The session opens at 9:30 wall clock time even on the day DST begins.
+    std::vector<TimePoint> after_dst(1);
+    SessionArrivals{10.0, open, close, NewYork}.fill(after_dst, TimePoint{mar/10/2024, NewYork}, 7);
+    EXPECT_GE(after_dst[0], TimePoint("2024-03-11 09:30:00", NewYork));
+    EXPECT_LT(after_dst[0], TimePoint("2024-03-11 09:31:00", NewYork));
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,73 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "core/chrono/asof_join.h"
+#include "coro/stream/stream.h"
+
+using namespace chron;
+using namespace coro;
+
+static std::vector<TimePoint> timepoints(std::size_t count, std::int64_t max) {
+    std::vector<TimePoint> tps;
+    for (auto nanos : sampler<std::int64_t>(0, max) | take(count))
+	tps.push_back(TimePoint{nanos});
+    std::sort(tps.begin(), tps.end());
+    return tps;
+}
+
+static std::vector<AsofPair> brute_force(std::span<const TimePoint> left,
+					 std::span<const TimePoint> right,
+					 nanos tolerance) {
+    std::vector<AsofPair> pairs;
+    for (std::size_t i = 0; i < left.size(); ++i) {
+	auto j = std::upper_bound(right.begin(), right.end(), left[i]) - right.begin();
+	if (j > 0 and left[i] - right[j - 1] <= tolerance)
+	    pairs.emplace_back(i, j - 1);
+    }
+    return pairs;
+}
+
+TEST(AsofJoin, Densities)
+{
+    for (auto [nleft, nright] : {std::pair{1000, 1000}, std::pair{100, 100'000},
+				 std::pair{100'000, 100}, std::pair{50'000, 50'000}}) {
+	auto left = timepoints(nleft, 1'000'000);
+	auto right = timepoints(nright, 1'000'000);
+	for (auto tolerance : {nanos::max(), nanos{0}, nanos{500}}) {
+	    auto expected = brute_force(left, right, tolerance);
+	    for (auto threads : {1u, 4u})
+		EXPECT_EQ(asof_join(left, right, tolerance, threads), expected);
+	}
+    }
+}
+
+TEST(AsofJoin, Duplicates)
+{
+    std::vector<TimePoint> left, right;
+    for (auto nanos : {1, 2, 2, 3, 5, 8})
+	left.push_back(TimePoint{std::int64_t(nanos)});
+    for (auto nanos : {2, 2, 2, 4, 8, 8})
+	right.push_back(TimePoint{std::int64_t(nanos)});
+
+    std::vector<AsofPair> expected = {{1, 2}, {2, 2}, {3, 2}, {4, 3}, {5, 5}};
+    EXPECT_EQ(asof_join(left, right), expected);
+
+    expected = {{1, 2}, {2, 2}, {5, 5}};
+    EXPECT_EQ(asof_join(left, right, nanos{0}), expected);
+}
+
+TEST(AsofJoin, Empty)
+{
+    std::vector<TimePoint> empty, some{TimePoint{std::int64_t{1}}};
+    EXPECT_TRUE(asof_join(empty, some).empty());
+    EXPECT_TRUE(asof_join(some, empty).empty());
+    EXPECT_TRUE(asof_join(empty, empty, nanos::max(), 8).empty());
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,119 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include "core/chrono/business_calendar.h"
+#include "core/chrono/date_stream.h"
+#include "coro/stream/stream.h"
+
+using namespace chron;
+using namespace coro;
+
+static const int NumberSamples = 64;
+
+static const Dates Holidays = {
+    jan/1/2024, jan/15/2024, feb/19/2024, mar/29/2024, may/27/2024, jun/19/2024,
+    jul/4/2024, sep/2/2024, nov/28/2024, dec/25/2024
+};
+
+static bool is_weekday(const Date& date) {
+    auto wd = date::weekday{date::sys_days{date}};
+    return wd != date::Saturday and wd != date::Sunday;
+}
+
+static bool is_business_day(const Date& date) {
+    return is_weekday(date) and std::find(Holidays.begin(), Holidays.end(), date) == Holidays.end();
+}
+
+TEST(BusinessCalendar, Range)
+{
+    BusinessCalendar calendar{2020, 2030};
+    EXPECT_EQ(calendar.first(), jan/1/2020);
+    EXPECT_EQ(calendar.last(), dec/31/2030);
+    EXPECT_TRUE(calendar.contains(jun/1/2025));
+    EXPECT_FALSE(calendar.contains(dec/31/2019));
+    EXPECT_FALSE(calendar.contains(jan/1/2031));
+    EXPECT_THROW(calendar.is_business_day(jan/1/2031), core::runtime_error);
+}
+
+TEST(BusinessCalendar, IsBusinessDay)
+{
+    BusinessCalendar calendar{2023, 2025, Holidays};
+    for (Date date = jan/1/2023; date <= dec/31/2025; ++date)
+	EXPECT_EQ(calendar.is_business_day(date), is_business_day(date)) << date;
+}
+
+TEST(BusinessCalendar, BusinessDaysBetween)
+{
+    BusinessCalendar calendar{2023, 2025, Holidays};
+    auto g = sampler<Date>(jan/1/2023, dec/31/2025) * sampler<Date>(jan/1/2023, dec/31/2025)
+	| zip() | take(NumberSamples);
+    for (auto [a, b] : g) {
+	auto [begin, end] = std::minmax(a, b);
+	std::int64_t expected{0};
+	for (auto date = begin; date < end; ++date)
+	    expected += is_business_day(date);
+	EXPECT_EQ(calendar.business_days_between(begin, end), expected);
+	EXPECT_EQ(calendar.business_days_between(end, begin), -expected);
+    }
+
+    // The end may be the day after the last day covered.
+    EXPECT_EQ(calendar.business_days_between(jan/1/2023, jan/1/2026), calendar.count());
+    EXPECT_EQ(calendar.business_days_between(jan/1/2026, dec/31/2025), -1);
+    EXPECT_EQ(calendar.business_days_between(jan/1/2026, jan/1/2026), 0);
+    EXPECT_THROW(calendar.business_days_between(jan/1/2023, jan/2/2026), core::runtime_error);
+    EXPECT_THROW(calendar.business_days_between(dec/31/2022, jan/1/2023), core::runtime_error);
+}
+
+TEST(BusinessCalendar, AddBusinessDays)
+{
+    BusinessCalendar calendar{2023, 2025, Holidays};
+    auto g = sampler<Date>(jan/1/2024, dec/31/2024) * sampler<int>(-100, 100)
+	| zip() | take(NumberSamples);
+    for (auto [date, n] : g) {
+	auto expected = date;
+	if (n == 0) {
+	    while (not is_business_day(expected))
+		++expected;
+	}
+	for (auto i = 0; i < n; ++i) {
+	    ++expected;
+	    while (not is_business_day(expected))
+		++expected;
+	}
+	for (auto i = 0; i > n; --i) {
+	    --expected;
+	    while (not is_business_day(expected))
+		--expected;
+	}
+	EXPECT_EQ(calendar.add_business_days(date, n), expected) << date << " " << n;
+    }
+
+    // The T+1 of the day before July 4th skips the holiday.
+    EXPECT_EQ(calendar.add_business_days(jul/3/2024, 1), jul/5/2024);
+    EXPECT_EQ(calendar.add_business_days(jul/5/2024, -1), jul/3/2024);
+    EXPECT_THROW(calendar.add_business_days(dec/31/2025, 1), core::runtime_error);
+}
+
+TEST(BusinessCalendar, SetOperations)
+{
+    BusinessCalendar a{2024, 2024, {jan/15/2024}};
+    BusinessCalendar b{2024, 2024, {feb/19/2024}};
+    auto both = a & b;
+    auto either = a | b;
+    EXPECT_FALSE(both.is_business_day(jan/15/2024));
+    EXPECT_FALSE(both.is_business_day(feb/19/2024));
+    EXPECT_TRUE(either.is_business_day(jan/15/2024));
+    EXPECT_TRUE(either.is_business_day(feb/19/2024));
+    EXPECT_EQ(both.count() + 2, either.count());
+    EXPECT_EQ(both, (BusinessCalendar{2024, 2024, {jan/15/2024, feb/19/2024}}));
+
+    BusinessCalendar c{2024, 2025};
+    EXPECT_THROW(a & c, core::runtime_error);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
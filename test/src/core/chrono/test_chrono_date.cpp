@@ -116,6 +116,17 @@ TEST(Date, UnixTs)
     }
 }
 
+TEST(Date, Constexpr)
+{
+    constexpr Date date{2024, 2, 28};
+    static_assert(date.tomorrow() == Date{2024, 2, 29});
+    static_assert(date + days{2} == Date{2024, 3, 1});
+    static_assert(Date{2024, 3, 1} - date == days{2});
+    static_assert(Date{1970, 1, 2}.unix_ts() == 86'400.0);
+    static_assert(Date::min() < date and date < Date::max());
+    EXPECT_EQ(date.unix_ts(), TimePoint{date}.unix_ts());
+}
+
 TEST(Date, TomorrowYesterday)
 {
     for (auto date : sampler<Date>() | take(NumberSamples)) {
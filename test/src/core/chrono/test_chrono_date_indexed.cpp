@@ -0,0 +1,94 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <map>
+#include <unordered_set>
+#include "core/chrono/date_indexed.h"
+#include "core/chrono/timepoint.h"
+
+using namespace chron;
+
+TEST(DateIndexed, Access)
+{
+    DateIndexed<int> values{feb/27/2024, mar/2/2024, -1};
+    EXPECT_EQ(values.size(), 5);
+    EXPECT_EQ(values.first(), feb/27/2024);
+    EXPECT_EQ(values.last(), mar/2/2024);
+    EXPECT_TRUE(values.contains(feb/29/2024));
+    EXPECT_FALSE(values.contains(feb/26/2024));
+    EXPECT_FALSE(values.contains(mar/3/2024));
+
+    values[feb/29/2024] = 29;
+    values.at(mar/1/2024) = 1;
+    EXPECT_EQ(values.at(feb/29/2024), 29);
+    EXPECT_EQ(*values.find(mar/1/2024), 1);
+    EXPECT_EQ(values.find(mar/3/2024), nullptr);
+    EXPECT_THROW(values.at(feb/26/2024), std::runtime_error);
+    EXPECT_EQ(std::vector<int>(values.begin(), values.end()), (std::vector<int>{-1, -1, 29, 1, -1}));
+    EXPECT_EQ(values.date(2), feb/29/2024);
+
+    std::map<Date, int> ordered;
+    values.for_each([&](const Date& date, int value) { ordered[date] = value; });
+    EXPECT_EQ(ordered.size(), 5);
+    EXPECT_EQ(ordered.begin()->first, feb/27/2024);
+    EXPECT_EQ(ordered[mar/1/2024], 1);
+
+    EXPECT_THROW((DateIndexed<int>{mar/2/2024, feb/27/2024}), std::runtime_error);
+}
+
+TEST(DateIndexed, Extend)
+{
+    DateIndexed<int> values;
+    EXPECT_TRUE(values.empty());
+    EXPECT_FALSE(values.contains(jan/1/2024));
+
+    values.extend(jan/10/2024, 7);
+    EXPECT_EQ(values.size(), 1);
+    EXPECT_EQ(values[jan/10/2024], 7);
+
+    values.extend(jan/7/2024);
+    values.extend(jan/12/2024, 3);
+    values.extend(jan/8/2024, 99);
+    EXPECT_EQ(values.first(), jan/7/2024);
+    EXPECT_EQ(values.last(), jan/12/2024);
+    EXPECT_EQ(std::vector<int>(values.begin(), values.end()), (std::vector<int>{0, 0, 0, 7, 3, 3}));
+}
+
+// Return the number of distinct buckets hit by the hashes of `keys` in a table of
+// `buckets` buckets (a power of two) indexed by the low bits.
+template<class T>
+std::size_t buckets_hit(const std::vector<T>& keys, std::size_t buckets) {
+    std::unordered_set<std::size_t> hit;
+    for (const auto& key : keys)
+	hit.insert(std::hash<T>{}(key) & (buckets - 1));
+    return hit.size();
+}
+
+TEST(DateIndexed, Hash)
+{
+    // Regularly spaced keys spread over the buckets like random keys, which hit about
+    // 63% of the buckets when there are as many keys as buckets.
+    const std::size_t n = 4096;
+    std::vector<Date> dates;
+    std::vector<TimePoint> tps;
+    std::vector<TimeOfDay> tods;
+    for (std::size_t i = 0; i < n; ++i) {
+	dates.push_back(Date{jan/1/2000} + days{i});
+	tps.push_back("2024-01-02 09:30:00"_utc + millis{i});
+	tods.push_back(TimeOfDay{millis{1024 * i}});
+    }
+    EXPECT_GT(buckets_hit(dates, n), n / 2);
+    EXPECT_GT(buckets_hit(tps, n), n / 2);
+    EXPECT_GT(buckets_hit(tods, n), n / 2);
+
+    EXPECT_EQ(std::hash<Date>{}(mar/1/2024), std::hash<Date>{}(Date{2024, 3, 1}));
+    EXPECT_NE(std::hash<Date>{}(mar/1/2024), std::hash<Date>{}(mar/2/2024));
+    EXPECT_EQ(std::hash<TimePoint>{}(TimePoint{std::int64_t{42}}), std::hash<TimePoint>{}(TimePoint{std::int64_t{42}}));
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
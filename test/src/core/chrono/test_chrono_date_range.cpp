@@ -0,0 +1,125 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#if __has_include(<execution>)
+#include <execution>
+#endif
+#include "core/chrono/chrono.h"
+#include "core/chrono/date_range.h"
+#include "core/chrono/date_stream.h"
+#include "coro/stream/stream.h"
+
+using namespace chron;
+using namespace coro;
+
+static const int NumberSamples = 32;
+
+static_assert(std::random_access_iterator<DateRange::iterator>);
+static_assert(std::ranges::random_access_range<DateRange>);
+static_assert(std::ranges::sized_range<DateRange>);
+static_assert(std::ranges::view<DateRange>);
+static_assert(std::is_signed_v<std::iter_difference_t<DateRange::iterator>>);
+
+TEST(DateRange, Daily)
+{
+    auto g = sampler<Date>(jan/1/1990, jan/1/2040) * sampler<int>(0, 400) * sampler<int>(1, 10)
+	| zip() | take(NumberSamples);
+    for (auto [begin, span, stride] : g) {
+	auto end = begin + days{span};
+	auto range = DateRange::daily(begin, end, stride);
+
+	Dates expected;
+	for (auto date = begin; date < end; date += days{stride})
+	    expected.push_back(date);
+
+	EXPECT_EQ(range.size(), expected.size());
+	EXPECT_EQ(std::distance(range.begin(), range.end()), std::ptrdiff_t(expected.size()));
+	EXPECT_TRUE(std::ranges::equal(range, expected));
+	for (std::size_t i = 0; i < expected.size(); ++i)
+	    EXPECT_EQ(range[i], expected[i]);
+    }
+}
+
+TEST(DateRange, Weekly)
+{
+    auto range = DateRange::weekly(jan/1/2024, feb/1/2024);
+    EXPECT_EQ(range.size(), 5);
+    EXPECT_EQ(range[4], jan/29/2024);
+    EXPECT_EQ(*std::prev(range.end()), jan/29/2024);
+}
+
+TEST(DateRange, Monthly)
+{
+    auto range = DateRange::monthly(jan/31/2024, jan/1/2025);
+    EXPECT_EQ(range.size(), 12);
+    EXPECT_EQ(range[1], feb/29/2024);
+    EXPECT_EQ(range[2], mar/31/2024);
+    EXPECT_EQ(range[3], apr/30/2024);
+    EXPECT_EQ(range[11], dec/31/2024);
+
+    auto quarters = DateRange::monthly(jan/15/2024, jan/15/2025, 3);
+    EXPECT_EQ(quarters.size(), 4);
+    EXPECT_EQ(quarters[3], oct/15/2024);
+
+    auto inclusive = DateRange::monthly(jan/15/2024, jan/16/2025, 3);
+    EXPECT_EQ(inclusive.size(), 5);
+}
+
+TEST(DateRange, Empty)
+{
+    EXPECT_TRUE(DateRange::daily(jan/2/2024, jan/1/2024).empty());
+    EXPECT_TRUE(DateRange::monthly(jan/2/2024, jan/2/2024).empty());
+    EXPECT_TRUE(DateRange{}.empty());
+    EXPECT_THROW(DateRange::daily(jan/1/2024, jan/2/2024, 0), core::runtime_error);
+}
+
+TEST(DateRange, RandomAccess)
+{
+    auto range = DateRange::daily(jan/1/1900, jan/1/2100);
+    auto mid = range.begin() + range.size() / 2;
+    EXPECT_EQ(mid - range.begin(), std::ptrdiff_t(range.size() / 2));
+    EXPECT_EQ(*std::ranges::lower_bound(range, jul/4/2000), jul/4/2000);
+
+    auto count = std::count_if(range.begin(), range.end(), [](Date date) {
+	return date.month() == feb and date.day() == date::day{29};
+    });
+    EXPECT_EQ(count, 49);
+}
+
+TEST(DateRange, Parallel)
+{
+#if __cpp_lib_parallel_algorithm
+    // The parallel algorithms split the range by index across threads.
+    auto range = DateRange::daily(jan/1/1950, jan/1/2050);
+    auto leap_days = std::transform_reduce(std::execution::par, range.begin(), range.end(),
+					   std::int64_t{0}, std::plus<>{}, [](Date date) {
+	return std::int64_t(date.month() == feb and date.day() == date::day{29});
+    });
+    EXPECT_EQ(leap_days, 25);
+
+    std::vector<std::int64_t> serials(range.size());
+    std::for_each(std::execution::par, range.begin(), range.end(), [&](Date date) {
+	serials[(date - jan/1/1950).count()] = date::sys_days{date}.time_since_epoch().count();
+    });
+    auto first = date::sys_days{Date{jan/1/1950}}.time_since_epoch().count();
+    for (std::size_t i = 0; i < serials.size(); ++i)
+	ASSERT_EQ(serials[i], first + std::int64_t(i));
+
+    auto months = DateRange::monthly(jan/31/1950, jan/1/2050);
+    auto last_days = std::count_if(std::execution::par, months.begin(), months.end(), [](Date date) {
+	return date.tomorrow().day() == date::day{1};
+    });
+    EXPECT_EQ(last_days, std::ptrdiff_t(months.size()));
+#else
+    GTEST_SKIP() << "the standard library does not provide the parallel algorithms";
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
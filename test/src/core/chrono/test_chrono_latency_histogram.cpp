@@ -0,0 +1,102 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include "core/chrono/latency_histogram.h"
+#include "coro/stream/stream.h"
+
+using namespace chron;
+using namespace coro;
+
+static const int NumberSamples = 10'000;
+
+TEST(LatencyHistogram, Index)
+{
+    LatencyHistogram histogram{hours{1}, 7};
+    for (auto value : sampler<std::int64_t>(0, 3'600'000'000'000ll) | take(NumberSamples)) {
+	auto index = histogram.index_of(value);
+	EXPECT_LE(histogram.value_of(index), value);
+	EXPECT_GT(histogram.value_of(index + 1), value);
+    }
+    for (std::uint64_t value = 0; value < 128; ++value)
+	EXPECT_EQ(histogram.value_of(histogram.index_of(value)), value);
+}
+
+TEST(LatencyHistogram, Percentile)
+{
+    LatencyHistogram histogram;
+    std::vector<std::int64_t> values;
+    for (auto value : sampler<std::int64_t>(0, 1'000'000) | take(NumberSamples)) {
+	values.push_back(value);
+	histogram.record(value);
+    }
+    std::sort(values.begin(), values.end());
+
+    EXPECT_EQ(histogram.count(), NumberSamples);
+    EXPECT_EQ(histogram.min().count(), values.front());
+    EXPECT_EQ(histogram.max().count(), values.back());
+    for (auto p : { 1.0, 50.0, 90.0, 99.0, 99.9 }) {
+	auto expected = values[std::size_t(p / 100.0 * NumberSamples) - 1];
+	auto actual = histogram.percentile(p).count();
+	EXPECT_NEAR(actual, expected, expected / 64.0 + 1);
+    }
+    EXPECT_EQ(histogram.percentile(100).count(), values.back());
+}
+
+TEST(LatencyHistogram, Overflow)
+{
+    LatencyHistogram histogram{millis{1}};
+    histogram.record(hours{1});
+    EXPECT_EQ(histogram.count(), 1);
+    EXPECT_EQ(histogram.count_at(histogram.size() - 1), 1);
+    EXPECT_EQ(histogram.max(), hours{1});
+}
+
+TEST(LatencyHistogram, Merge)
+{
+    LatencyHistogram a, b, all;
+    for (auto value : sampler<std::int64_t>(0, 1'000'000) | take(NumberSamples)) {
+	(value % 2 ? a : b).record(value);
+	all.record(value);
+    }
+    a.merge(b);
+    EXPECT_EQ(a.count(), all.count());
+    EXPECT_EQ(a.min(), all.min());
+    EXPECT_EQ(a.max(), all.max());
+    for (std::size_t i = 0; i < a.size(); ++i)
+	EXPECT_EQ(a.count_at(i), all.count_at(i));
+
+    LatencyHistogram other{hours{1}, 3};
+    EXPECT_THROW(a.merge(other), core::runtime_error);
+}
+
+TEST(LatencyHistogram, StopWatch)
+{
+    LatencyHistogram histogram;
+    StopWatch sw;
+    for (auto i = 0; i < 100; ++i)
+	histogram.record(sw);
+    EXPECT_EQ(histogram.count(), 100);
+}
+
+TEST(LatencyHistogram, Save)
+{
+    LatencyHistogram histogram;
+    histogram.record(100);
+    auto path = testing::TempDir() + "latency_histogram.txt";
+    histogram.save(path);
+    std::ifstream ifs{path};
+    std::string line;
+    std::getline(ifs, line);
+    EXPECT_EQ(line.substr(0, 7), "count 1");
+    std::remove(path.c_str());
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -28,6 +28,60 @@ TEST(LowResClock, Virtual)
     EXPECT_NE(clock.virtual_now(), clock.now());
 }
 
+TEST(LowResClock, Calendar)
+{
+    TimeZoneName tzname{"America/New_York"};
+    auto start = TimePoint{mar/9/2024, tzname} + hours{23};
+    LowResClock::Calendar calendar{tzname, start};
+    EXPECT_EQ(calendar.date(), mar/9/2024);
+    EXPECT_EQ(calendar.day_start(), TimePoint(mar/9/2024, tzname));
+
+    // Step through the short day of the spring forward transition and into the next.
+    for (auto tp = start; tp < start + hours{26}; tp += minutes{1}) {
+	calendar.update(tp);
+	EXPECT_EQ(calendar.date(), tp.date(tzname));
+	EXPECT_EQ(calendar.day_start(), tp.midnight(tzname));
+	EXPECT_EQ(calendar.time_of_day(tp), tp.time_of_day(tzname));
+    }
+
+    // A reader that read the time just before the day rolled over uses the previous day.
+    auto midnight = TimePoint{mar/11/2024, tzname};
+    calendar.update(midnight);
+    EXPECT_EQ(calendar.time_of_day(midnight - nanos{1}).to_duration(), hours{23} - nanos{1});
+}
+
+TEST(LowResClock, Zones)
+{
+    LowResClock clock{LowResClock::Mode::RealTime, 1ms};
+    auto new_york = clock.add_zone(TimeZoneName{"America/New_York"});
+    auto utc = clock.add_zone(TimeZoneName{"UTC"});
+    EXPECT_NE(new_york, utc);
+    EXPECT_EQ(clock.add_zone(TimeZoneName{"EST"}), new_york);
+
+    for (auto [index, tzname] : {std::pair{new_york, TimeZoneName{"America/New_York"}},
+				 std::pair{utc, TimeZoneName{"UTC"}}}) {
+	auto now = clock.now();
+	auto today = clock.today(index);
+	EXPECT_LE(clock.day_start(index), now);
+	EXPECT_LE(today, now.date(tzname));
+	EXPECT_GE(today, now.date(tzname) - days{1});
+	EXPECT_LT(clock.time_of_day(index).to_duration(), hours{25});
+    }
+    EXPECT_EQ(clock.today(utc), clock.now().date());
+
+    // Registering more than the maximum number of zones fails.
+    auto register_all = [&]() {
+	for (auto name : {"Europe/Berlin", "Asia/Tokyo", "Europe/London", "Asia/Kolkata",
+			  "Australia/Sydney", "America/Chicago", "America/Denver",
+			  "America/Los_Angeles", "Asia/Shanghai", "Asia/Singapore",
+			  "America/Sao_Paulo", "Africa/Johannesburg", "Asia/Dubai",
+			  "Pacific/Auckland", "America/Anchorage", "Pacific/Honolulu",
+			  "Asia/Kathmandu", "America/St_Johns", "Australia/Adelaide"})
+	    clock.add_zone(TimeZoneName{name});
+    };
+    EXPECT_THROW(register_all(), std::runtime_error);
+}
+
 int main(int argc, char *argv[])
 {
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,121 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "core/chrono/concurrent_periodically.h"
+#include "core/chrono/lowres_clock.h"
+#include "core/chrono/periodically.h"
+#include "core/chrono/tsc_clock.h"
+
+using namespace chron;
+
+struct ManualTimeSource {
+    TimePoint *tp;
+    TimePoint now() const { return *tp; }
+};
+
+TEST(Periodically, SystemClock)
+{
+    Periodically periodic{1h};
+    EXPECT_TRUE(periodic());
+    EXPECT_FALSE(periodic());
+    EXPECT_FALSE(periodic());
+}
+
+TEST(Periodically, TimeSource)
+{
+    TimePoint tp{std::int64_t{1'000'000}};
+    BasicPeriodically<ManualTimeSource> periodic{10ns, ManualTimeSource{&tp}};
+    EXPECT_TRUE(periodic());
+    tp += 9ns;
+    EXPECT_FALSE(periodic());
+    tp += 1ns;
+    EXPECT_TRUE(periodic());
+    EXPECT_FALSE(periodic());
+}
+
+TEST(Periodically, CheckInterval)
+{
+    TimePoint tp{std::int64_t{1'000'000}};
+    BasicPeriodically<ManualTimeSource> periodic{10ns, ManualTimeSource{&tp}, 4};
+    EXPECT_TRUE(periodic());
+
+    tp += 1h;
+    EXPECT_FALSE(periodic());
+    EXPECT_FALSE(periodic());
+    EXPECT_FALSE(periodic());
+    EXPECT_TRUE(periodic());
+    EXPECT_FALSE(periodic());
+}
+
+TEST(Periodically, LowResClock)
+{
+    LowResClock clock{LowResClock::Mode::RealTime, 1ms};
+    BasicPeriodically<ClockTimeSource<LowResClock>> periodic{1h, clock};
+    EXPECT_TRUE(periodic());
+    EXPECT_FALSE(periodic());
+}
+
+TEST(Periodically, TscClock)
+{
+    TscClock clock;
+    BasicPeriodically<ClockTimeSource<TscClock>> periodic{1h, clock, 16};
+    EXPECT_TRUE(periodic());
+    for (auto i = 0; i < 64; ++i)
+	EXPECT_FALSE(periodic());
+}
+
+TEST(ConcurrentPeriodically, SingleWinner)
+{
+    TimePoint tp{std::int64_t{1'000'000}};
+    BasicConcurrentPeriodically<ManualTimeSource> periodic{1h, ManualTimeSource{&tp}};
+    std::atomic<int> count{0};
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < 32; ++i)
+	threads.emplace_back([&]() {
+	    for (auto j = 0; j < 1000; ++j)
+		count += periodic();
+	});
+    for (auto& thread : threads)
+	thread.join();
+    EXPECT_EQ(count, 1);
+}
+
+TEST(TokenBucket, Burst)
+{
+    TimePoint tp{std::int64_t{1'000'000}};
+    BasicTokenBucket<ManualTimeSource> bucket{5, 100ns, ManualTimeSource{&tp}};
+    std::atomic<int> count{0};
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < 32; ++i)
+	threads.emplace_back([&]() {
+	    for (auto j = 0; j < 1000; ++j)
+		count += bucket();
+	});
+    for (auto& thread : threads)
+	thread.join();
+    EXPECT_EQ(count, 5);
+
+    tp += 20ns;
+    EXPECT_TRUE(bucket());
+    EXPECT_FALSE(bucket());
+    tp += 100ns;
+    for (auto i = 0; i < 5; ++i)
+	EXPECT_TRUE(bucket());
+    EXPECT_FALSE(bucket());
+}
+
+TEST(TokenBucket, InvalidArguments)
+{
+    EXPECT_THROW(TokenBucket(0, 1s), std::runtime_error);
+    EXPECT_THROW(TokenBucket(-1, 1s), std::runtime_error);
+    EXPECT_THROW(TokenBucket(2'000'000'000, 1s), std::runtime_error);
+    EXPECT_NO_THROW(TokenBucket(1'000'000'000, 1s));
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,49 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "core/chrono/precise_stopwatch.h"
+
+using namespace chron;
+
+TEST(TrialStats, From)
+{
+    auto stats = TrialStats::from({ 5.0, 1.0, 3.0, 100.0, 2.0 });
+    EXPECT_EQ(stats.trials, 5);
+    EXPECT_EQ(stats.min, 1.0);
+    EXPECT_EQ(stats.median, 3.0);
+    EXPECT_EQ(stats.mad, 2.0);
+
+    auto even = TrialStats::from({ 4.0, 1.0, 3.0, 2.0 });
+    EXPECT_EQ(even.median, 2.5);
+    EXPECT_EQ(even.mad, 1.0);
+
+    auto empty = TrialStats::from({});
+    EXPECT_EQ(empty.trials, 0);
+}
+
+TEST(PreciseStopWatch, Overhead)
+{
+    PreciseStopWatch sw;
+    EXPECT_GT(sw.overhead(), 0);
+    auto stats = sw.measure([]() {}, 1000);
+    EXPECT_EQ(stats.trials, 1000);
+    // The calibrated overhead is subtracted, so an empty measurement is at most a few
+    // ticks even though a raw serialized read costs tens of nanoseconds.
+    EXPECT_LT(stats.min, 0.25 * sw.overhead() * sw.clock().nanos_per_tick() + 2.0);
+}
+
+TEST(PreciseStopWatch, Sleep)
+{
+    PreciseStopWatch sw;
+    auto elapsed = sw.time([]() { std::this_thread::sleep_for(std::chrono::milliseconds{2}); });
+    EXPECT_GT(elapsed, 2e6);
+    EXPECT_LT(elapsed, 2e8);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
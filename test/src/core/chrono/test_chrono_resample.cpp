@@ -0,0 +1,134 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "core/chrono/chrono.h"
+#include "core/chrono/resample.h"
+#include "core/chrono/date_stream.h"
+#include "core/chrono/time_of_day_stream.h"
+#include "coro/stream/stream.h"
+
+using namespace chron;
+using namespace coro;
+
+static const int NumberSamples = 64;
+
+static const TimeZoneName NewYork{"America/New_York"};
+
+TEST(Bucketer, Duration)
+{
+    Bucketer bucketer{std::chrono::minutes{5}, NewYork};
+    for (auto [date, tod] : sampler<Date>() * sampler<TimeOfDay>() | zip() | take(NumberSamples)) {
+	TimePoint tp{date, tod, NewYork};
+	auto b = bucketer.bucket(tp);
+	EXPECT_TRUE(b.contains(tp));
+	EXPECT_LE(b.end - b.begin, std::chrono::minutes{5});
+	EXPECT_EQ(b.begin.date(NewYork), date);
+
+	auto [d, t] = b.begin.components(NewYork);
+	EXPECT_EQ(t.to_duration() % std::chrono::minutes{5}, nanos{0});
+	EXPECT_EQ(bucketer.floor(tp), b.begin);
+	EXPECT_EQ(bucketer.ceil(b.begin), b.begin);
+	if (tp != b.begin) {
+	    EXPECT_EQ(bucketer.ceil(tp), b.end);
+	}
+    }
+}
+
+TEST(Bucketer, DaylightSaving)
+{
+    Bucketer hourly{std::chrono::hours{1}, NewYork};
+    TimePoint begin{mar/10/2024, NewYork}, end{mar/11/2024, NewYork};
+    std::vector<TimePoint> tps;
+    for (auto tp = begin; tp < end; tp += std::chrono::minutes{1})
+	tps.push_back(tp);
+    auto ids = hourly.bucketize(tps);
+    EXPECT_TRUE(std::is_sorted(ids.begin(), ids.end()));
+    EXPECT_EQ(std::unique(ids.begin(), ids.end()) - ids.begin(), 23);
+
+    Bucketer daily{Bucketer::Period::Day, NewYork};
+    auto day = daily.bucket(begin + std::chrono::hours{12});
+    EXPECT_EQ(day.begin, begin);
+    EXPECT_EQ(day.end, end);
+    EXPECT_EQ(day.end - day.begin, std::chrono::hours{23});
+}
+
+TEST(Bucketer, Calendar)
+{
+    Bucketer weekly{Bucketer::Period::Week, NewYork};
+    Bucketer monthly{Bucketer::Period::Month, NewYork};
+    Bucketer quarterly{Bucketer::Period::Quarter, NewYork};
+    for (auto date : sampler<Date>() | take(NumberSamples)) {
+	TimePoint tp{date, TimeOfDay{13, 30, 0}, NewYork};
+
+	auto week = weekly.bucket(tp);
+	auto monday = week.begin.date(NewYork);
+	EXPECT_EQ(date::weekday{monday}, date::Monday);
+	EXPECT_EQ(week.end, TimePoint(monday + days{7}, NewYork));
+	EXPECT_TRUE(week.contains(tp));
+
+	auto month = monthly.bucket(tp);
+	EXPECT_EQ(month.begin, TimePoint(Date{date.year()/date.month()/1}, NewYork));
+	EXPECT_TRUE(month.contains(tp));
+
+	auto quarter = quarterly.bucket(tp);
+	auto first = quarter.begin.date(NewYork);
+	EXPECT_EQ(unsigned(first.day()), 1u);
+	EXPECT_EQ((unsigned(first.month()) - 1) % 3, 0u);
+	EXPECT_TRUE(quarter.contains(tp));
+	EXPECT_EQ(quarter.id, 4 * int(date.year()) + (unsigned(date.month()) - 1) / 3);
+    }
+}
+
+TEST(Bucketer, BucketizeMatchesBucket)
+{
+    Bucketer bucketer{std::chrono::seconds{90}, NewYork};
+    std::vector<TimePoint> tps;
+    for (auto tod : sampler<TimeOfDay>() | take(4 * NumberSamples))
+	tps.push_back(TimePoint{dec/31/2023, tod, NewYork});
+    std::sort(tps.begin(), tps.end());
+    auto ids = bucketer.bucketize(tps);
+    for (std::size_t i = 0; i < tps.size(); ++i)
+	EXPECT_EQ(ids[i], bucketer.bucket(tps[i]).id);
+}
+
+TEST(Bucketer, Errors)
+{
+    EXPECT_THROW(Bucketer(nanos{0}), std::runtime_error);
+    EXPECT_THROW(Bucketer(std::chrono::hours{25}), std::runtime_error);
+}
+
+TEST(Resampler, Bars)
+{
+    Resampler resampler{Bucketer{std::chrono::minutes{1}}};
+    TimePoint start{jan/2/2024, TimeOfDay{9, 30, 0}};
+    std::vector<Bar> bars;
+    for (auto i = 0; i < 180; ++i) {
+	auto tp = start + std::chrono::seconds{i};
+	if (auto bar = resampler.add(tp, double(i % 60 == 30 ? 1000 : i)))
+	    bars.push_back(*bar);
+    }
+    if (auto bar = resampler.flush())
+	bars.push_back(*bar);
+    EXPECT_FALSE(resampler.flush());
+
+    ASSERT_EQ(bars.size(), 3);
+    for (auto k = 0; k < 3; ++k) {
+	const auto& bar = bars[k];
+	EXPECT_EQ(bar.bucket.begin, start + std::chrono::minutes{k});
+	EXPECT_EQ(bar.count, 60);
+	EXPECT_EQ(bar.open, 60 * k);
+	EXPECT_EQ(bar.close, 60 * k + 59);
+	EXPECT_EQ(bar.high, 1000);
+	EXPECT_EQ(bar.low, 60 * k);
+    }
+    resampler.add(start + std::chrono::minutes{3}, 0.0);
+    EXPECT_THROW(resampler.add(start, 0.0), std::runtime_error);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,103 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+#include "core/chrono/chrono_stream.h"
+#include "core/chrono/counter_rng.h"
+
+using namespace chron;
+using namespace coro;
+
+static const std::size_t NumberSamples = 10'000;
+
+// Fill `out` by having each of `threads` threads fill a contiguous chunk.
+template<class T, class F>
+void parallel_fill(std::vector<T>& out, unsigned threads, F fill) {
+    std::vector<std::thread> workers;
+    auto chunk = (out.size() + threads - 1) / threads;
+    for (unsigned t = 0; t < threads; ++t) {
+	auto begin = std::min(out.size(), t * chunk);
+	auto end = std::min(out.size(), begin + chunk);
+	workers.emplace_back([&, begin, end]() {
+	    fill(std::span{out}.subspan(begin, end - begin), begin);
+	});
+    }
+    for (auto& worker : workers)
+	worker.join();
+}
+
+template<class T>
+void check_fill(T start, T end, const std::vector<T>& dflt) {
+    std::vector<T> expected{dflt};
+    Sampler<T>::fill(expected, start, end, 42);
+    for (const auto& value : expected) {
+	EXPECT_GE(value, start);
+	EXPECT_LE(value, end);
+    }
+    EXPECT_NE(expected.front(), expected.back());
+
+    std::vector<T> again{dflt};
+    Sampler<T>::fill(again, start, end, 42);
+    EXPECT_EQ(again, expected);
+
+    std::vector<T> other{dflt};
+    Sampler<T>::fill(other, start, end, 43);
+    EXPECT_NE(other, expected);
+
+    for (auto threads : {2u, 3u, 7u}) {
+	std::vector<T> actual{dflt};
+	parallel_fill(actual, threads, [&](std::span<T> out, std::size_t index) {
+	    Sampler<T>::fill(out, start, end, 42, index);
+	});
+	EXPECT_EQ(actual, expected);
+    }
+}
+
+TEST(SamplerFill, Date)
+{
+    std::vector<Date> dflt(NumberSamples, jan/1/2000);
+    check_fill<Date>(jan/1/1990, jan/1/2040, dflt);
+    check_fill<Date>(jan/1/-30000, dec/31/30000, dflt);
+}
+
+TEST(SamplerFill, TimePoint)
+{
+    std::vector<TimePoint> dflt(NumberSamples);
+    check_fill(TimePoint{jan/1/1990}, TimePoint{jan/1/2040}, dflt);
+    check_fill(TimePoint{std::numeric_limits<std::int64_t>::min()}, TimePoint::max(), dflt);
+}
+
+TEST(SamplerFill, TimeOfDay)
+{
+    std::vector<TimeOfDay> dflt(NumberSamples);
+    check_fill(TimeOfDay::min(), TimeOfDay::max(), dflt);
+    check_fill(TimeOfDay{9, 30, 0}, TimeOfDay{16, 0, 0}, dflt);
+}
+
+TEST(SamplerFill, Duration)
+{
+    check_fill(millis{-1000}, millis{1000}, std::vector<millis>(NumberSamples));
+    check_fill(nanos::min(), nanos::max(), std::vector<nanos>(NumberSamples));
+}
+
+TEST(SamplerFill, Uniformity)
+{
+    CounterRng rng{7};
+    std::array<int, 10> counts{};
+    double sum{0};
+    for (std::size_t i = 0; i < 100'000; ++i) {
+	++counts[rng.below(i, counts.size())];
+	sum += rng.uniform(i);
+    }
+    for (auto count : counts)
+	EXPECT_NEAR(count, 10'000, 500);
+    EXPECT_NEAR(sum / 100'000, 0.5, 0.01);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,96 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include "core/chrono/schedule.h"
+
+using namespace chron;
+
+TEST(Schedule, Weekdays)
+{
+    TimeZoneName tz{"America/New_York"};
+    TimePoint from{Date{2024, 3, 8}, TimeOfDay{12, 0, 0}, tz};
+    auto schedule = Schedule::weekly(Schedule::Weekdays,
+				     {TimeOfDay{16, 0, 0}, TimeOfDay{9, 30, 0}},
+				     tz, from);
+
+    std::vector<TimePoint> expected = {
+	TimePoint{Date{2024, 3, 8}, TimeOfDay{16, 0, 0}, tz},
+	TimePoint{Date{2024, 3, 11}, TimeOfDay{9, 30, 0}, tz},
+	TimePoint{Date{2024, 3, 11}, TimeOfDay{16, 0, 0}, tz}
+    };
+    EXPECT_EQ(schedule.next(), expected[0]);
+
+    EXPECT_FALSE(schedule(from));
+    for (auto tp : expected) {
+	EXPECT_FALSE(schedule.due(tp - 1ns));
+	EXPECT_TRUE(schedule.due(tp));
+	EXPECT_TRUE(schedule(tp));
+	EXPECT_FALSE(schedule(tp));
+    }
+
+    // Crossing the spring DST transition keeps the local time of day.
+    EXPECT_EQ(schedule.next().time_of_day(tz), (TimeOfDay{9, 30, 0}));
+    EXPECT_EQ(schedule.next().date(tz), (Date{2024, 3, 12}));
+}
+
+TEST(Schedule, Refill)
+{
+    TimePoint from{Date{2024, 1, 1}};
+    Schedule schedule{Schedule::Rule::Weekly, {TimeOfDay{0, 0, 0}}, TimeZoneName{},
+	Schedule::EveryDay, from};
+    for (auto i = 0; i < 3 * (int)Schedule::Depth; ++i) {
+	TimePoint tp{Date{2024, 1, 1} + days{i}};
+	EXPECT_EQ(schedule.next(), tp);
+	EXPECT_TRUE(schedule(tp));
+    }
+}
+
+TEST(Schedule, CoalesceMissed)
+{
+    TimePoint from{Date{2024, 1, 1}};
+    Schedule schedule{Schedule::Rule::Weekly, {TimeOfDay{12, 0, 0}}, TimeZoneName{},
+	Schedule::EveryDay, from};
+    EXPECT_TRUE(schedule(TimePoint{Date{2024, 2, 1}}));
+    EXPECT_EQ(schedule.next(), (TimePoint{Date{2024, 2, 1}, TimeOfDay{12, 0, 0}}));
+}
+
+TEST(Schedule, LastBusinessDayOfMonth)
+{
+    TimeZoneName tz{"America/New_York"};
+    TimePoint from{Date{2024, 1, 1}, tz};
+    Schedule schedule{Schedule::Rule::LastBusinessDayOfMonth, {TimeOfDay{17, 0, 0}}, tz,
+	Schedule::Weekdays, from};
+
+    std::vector<Date> expected = {
+	Date{2024, 1, 31}, Date{2024, 2, 29}, Date{2024, 3, 29}, Date{2024, 4, 30},
+	Date{2024, 5, 31}, Date{2024, 6, 28}
+    };
+    for (auto date : expected) {
+	TimePoint tp{date, TimeOfDay{17, 0, 0}, tz};
+	EXPECT_EQ(schedule.next(), tp);
+	EXPECT_TRUE(schedule(tp));
+    }
+}
+
+TEST(Schedule, FirstBusinessDayOfMonth)
+{
+    TimePoint from{Date{2024, 6, 1}};
+    Schedule schedule{Schedule::Rule::FirstBusinessDayOfMonth, {TimeOfDay{8, 0, 0}},
+	TimeZoneName{}, Schedule::Weekdays, from};
+    EXPECT_EQ(schedule.next().date(), (Date{2024, 6, 3}));
+}
+
+TEST(Schedule, Empty)
+{
+    Schedule schedule{Schedule::Rule::Weekly, {}, TimeZoneName{}, Schedule::Weekdays,
+	TimePoint::epoch()};
+    EXPECT_EQ(schedule.next(), TimePoint::max());
+    EXPECT_FALSE(schedule(TimePoint::now()));
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
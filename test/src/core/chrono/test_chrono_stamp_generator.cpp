@@ -0,0 +1,165 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+#include "core/chrono/duration.h"
+#include "core/chrono/stamp_generator.h"
+
+using namespace chron;
+
+static const std::size_t NumberStamps = 20'000;
+
+// Check that `generator` issues unique stamps to `nthreads` threads that increase on each
+// thread and that a stamp is larger than any stamp returned before it was requested.
+template<class Generator>
+void check_order(Generator& generator, std::size_t nthreads) {
+    std::atomic<std::int64_t> latest{std::numeric_limits<std::int64_t>::min()};
+    std::atomic<std::size_t> failures{0};
+    std::vector<std::vector<TimePoint>> stamps(nthreads);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < nthreads; ++t)
+	threads.emplace_back([&, t]() {
+	    auto& mine = stamps[t];
+	    for (std::size_t i = 0; i < NumberStamps; ++i) {
+		auto seen = latest.load();
+		auto stamp = generator();
+		auto n = stamp.time_since_epoch().count();
+		if (n <= seen)
+		    ++failures;
+		while (seen < n and not latest.compare_exchange_weak(seen, n));
+		mine.push_back(stamp);
+	    }
+	});
+    for (auto& thread : threads)
+	thread.join();
+    EXPECT_EQ(failures, 0);
+
+    std::vector<TimePoint> all;
+    for (const auto& mine : stamps) {
+	EXPECT_TRUE(std::is_sorted(mine.begin(), mine.end()));
+	EXPECT_EQ(std::adjacent_find(mine.begin(), mine.end()), mine.end());
+	all.insert(all.end(), mine.begin(), mine.end());
+    }
+    std::sort(all.begin(), all.end());
+    EXPECT_EQ(std::adjacent_find(all.begin(), all.end()), all.end());
+    auto now = TimePoint::now();
+    EXPECT_LE(all.back(), now);
+    EXPECT_GT(all.front(), now - seconds{60});
+}
+
+TEST(StampGenerator, Sharded)
+{
+    StampGenerator generator{4};
+    EXPECT_EQ(generator.slots(), 4);
+    check_order(generator, 4);
+}
+
+TEST(StampGenerator, SharedSlots)
+{
+    // Three and four threads per slot queue behind each other on each slot.
+    StampGenerator four{4};
+    check_order(four, 12);
+    StampGenerator two{2};
+    check_order(two, 8);
+}
+
+TEST(StampGenerator, Slots)
+{
+    StampGenerator generator{5};
+    EXPECT_EQ(generator.slots(), 8);
+    // Live threads have distinct slots, and the slot of a thread that has exited is reused.
+    std::size_t slot{0}, reused{0};
+    std::atomic<bool> ready{false}, done{false};
+    std::thread live([&]() {
+	slot = generator.slot(generator());
+	ready = true;
+	while (not done)
+	    std::this_thread::yield();
+    });
+    while (not ready)
+	std::this_thread::yield();
+    auto stamp = generator();
+    EXPECT_NE(generator.slot(stamp), slot);
+    EXPECT_GT(generator(), stamp);
+    done = true;
+    live.join();
+
+    std::thread([&]() { reused = generator.slot(generator()); }).join();
+    EXPECT_EQ(reused, slot);
+}
+
+TEST(StampGenerator, Atomic)
+{
+    AtomicStampGenerator generator;
+    check_order(generator, 8);
+}
+
+// A time source that only advances when it is set.
+struct ManualTimeSource {
+    static inline std::atomic<std::int64_t> nanos{1'000'000};
+    TimePoint now() const { return TimePoint{nanos.load()}; }
+};
+
+TEST(StampGenerator, Queued)
+{
+    // Stamps queued on a slot are only returned once the clock reaches them, however far
+    // ahead of the clock the queue runs.
+    BasicStampGenerator<ManualTimeSource> generator{1};
+    std::atomic<std::size_t> returned{0};
+    std::vector<TimePoint> stamps(6);
+    std::vector<std::thread> threads;
+    for (auto& stamp : stamps)
+	threads.emplace_back([&]() {
+	    stamp = generator();
+	    ++returned;
+	});
+    std::this_thread::sleep_for(millis{50});
+    EXPECT_EQ(returned, 1);
+
+    ManualTimeSource::nanos += 2;
+    std::this_thread::sleep_for(millis{50});
+    EXPECT_EQ(returned, 3);
+
+    ManualTimeSource::nanos += 3;
+    for (auto& thread : threads)
+	thread.join();
+    std::sort(stamps.begin(), stamps.end());
+    for (std::int64_t i = 0; i < 6; ++i)
+	EXPECT_EQ(stamps[i], TimePoint{1'000'000 + i});
+}
+
+// A time source that advances a nanosecond each time it is read and can be stepped.
+struct SteppedTimeSource {
+    static inline std::atomic<std::int64_t> nanos{1'000'000};
+    TimePoint now() const { return TimePoint{nanos.fetch_add(1)}; }
+};
+
+TEST(StampGenerator, ClockStepsBack)
+{
+    // Stamps continue from the last stamp rather than waiting for the clock to catch up.
+    BasicStampGenerator<SteppedTimeSource> sharded{4};
+    BasicAtomicStampGenerator<SteppedTimeSource> atomic;
+    TimePoint prev_sharded, prev_atomic;
+    for (auto i = 0; i < 100; ++i) {
+	if (i == 50)
+	    SteppedTimeSource::nanos -= 1'000'000'000;
+	auto stamp = sharded();
+	EXPECT_GT(stamp, prev_sharded);
+	if (i > 0) {
+	    EXPECT_EQ(sharded.slot(stamp), sharded.slot(prev_sharded));
+	}
+	prev_sharded = stamp;
+
+	stamp = atomic();
+	EXPECT_GT(stamp, prev_atomic);
+	prev_atomic = stamp;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,192 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include "core/chrono/time_log.h"
+
+using namespace chron;
+
+static const std::size_t NumberThreads = 4;
+static const std::size_t NumberRecords = 500;
+
+static std::string read_file(const std::string& path) {
+    std::ifstream ifs{path, std::ios::binary};
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    return ss.str();
+}
+
+// Record timestamps from several threads as `output` and return the expected lines, in
+// any order, and the lines written.
+static std::pair<std::multiset<std::string>, std::string> capture(TimeLog::Output output) {
+    auto path = testing::TempDir() + "chrono_time_log.bin";
+    auto& log = TimeLog::instance();
+    std::vector<TimeZoneName> tznames{TimeZoneName{"America/New_York"},
+				      TimeZoneName{"Asia/Tokyo"},
+				      TimeZoneName{}};
+    std::vector<std::string> fmts{"%Y%m%d %H%M%S %Z", "%FT%T%z", "%F %T"};
+    std::vector<TimeLog::FormatId> formats;
+    for (const auto& fmt : fmts)
+	formats.push_back(TimeLog::format_id(fmt));
+
+    // Records are ignored until the log is started.
+    log.record(TimePoint::now(), 0);
+    log.start(path, output, millis{1});
+    EXPECT_TRUE(log.enabled());
+    std::vector<std::multiset<std::string>> expected(NumberThreads);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < NumberThreads; ++t)
+	threads.emplace_back([&, t]() {
+	    auto tp = "2024-03-10 06:00:00"_utc + hours{t};
+	    for (std::size_t i = 0; i < NumberRecords; ++i, tp += minutes{1}) {
+		auto k = i % 3;
+		log.record(tp, TimeLog::zone_id(tznames[k]), formats[k], i);
+		expected[t].insert(fmt::format("{}\t{}", i, tp.to_string(tznames[k], fmts[k])));
+	    }
+	});
+    for (auto& thread : threads)
+	thread.join();
+    log.stop();
+    EXPECT_FALSE(log.enabled());
+    EXPECT_EQ(log.dropped(), 0);
+
+    std::multiset<std::string> all;
+    for (const auto& lines : expected)
+	all.insert(lines.begin(), lines.end());
+    auto str = read_file(path);
+    std::remove(path.c_str());
+    return {all, str};
+}
+
+// Return the lines of `text` without the leading thread number.
+static std::multiset<std::string> strip_thread(const std::string& text) {
+    std::multiset<std::string> lines;
+    std::istringstream is{text};
+    for (std::string line; std::getline(is, line); )
+	lines.insert(line.substr(line.find('\t') + 1));
+    return lines;
+}
+
+TEST(TimeLog, FormatId)
+{
+    EXPECT_EQ(TimeLog::format_id("%F %T"), 0);
+    auto id = TimeLog::format_id("%H:%M");
+    EXPECT_NE(id, 0);
+    EXPECT_EQ(TimeLog::format_id("%H:%M"), id);
+}
+
+TEST(TimeLog, Text)
+{
+    auto [expected, text] = capture(TimeLog::Output::Text);
+    EXPECT_EQ(strip_thread(text), expected);
+}
+
+TEST(TimeLog, Binary)
+{
+    auto [expected, binary] = capture(TimeLog::Output::Binary);
+    EXPECT_EQ(binary.substr(0, 8), "ChronTL1");
+    EXPECT_LT(binary.size(), 20 * NumberThreads * NumberRecords);
+
+    std::istringstream is{binary};
+    std::ostringstream os;
+    TimeLog::decode(is, os);
+    EXPECT_EQ(strip_thread(os.str()), expected);
+
+    std::istringstream bad{"NotALog!"};
+    EXPECT_THROW(TimeLog::decode(bad, os), std::runtime_error);
+    std::istringstream truncated{binary.substr(0, binary.size() - 1)};
+    EXPECT_THROW(TimeLog::decode(truncated, os), std::runtime_error);
+}
+
+TEST(TimeLog, UnknownZone)
+{
+    // A zone id that was never registered is rendered as UTC rather than failing on the
+    // flusher thread.
+    auto path = testing::TempDir() + "chrono_time_log_zone.bin";
+    auto& log = TimeLog::instance();
+    auto tp = "2024-07-01 12:00:00"_utc;
+    for (auto output : {TimeLog::Output::Text, TimeLog::Output::Binary}) {
+	log.start(path, output, millis{1});
+	log.record(tp, 999, 0, 7);
+	log.stop();
+
+	auto text = read_file(path);
+	if (output == TimeLog::Output::Binary) {
+	    std::istringstream is{text};
+	    std::ostringstream os;
+	    TimeLog::decode(is, os);
+	    text = os.str();
+	}
+	EXPECT_EQ(strip_thread(text), (std::multiset<std::string>{"7\t" + tp.to_string()}));
+    }
+    std::remove(path.c_str());
+}
+
+TEST(TimeLog, UniqueThreadNumbers)
+{
+    // A thread that starts after another has exited and been drained gets a new number
+    // while an older thread is still live.
+    auto path = testing::TempDir() + "chrono_time_log_tids.txt";
+    auto& log = TimeLog::instance();
+    auto tp = TimePoint::now();
+    log.start(path, TimeLog::Output::Text, millis{1});
+
+    std::atomic<bool> done{false};
+    std::thread live([&]() {
+	log.record(tp, 0, 0, 1);
+	while (not done)
+	    std::this_thread::yield();
+    });
+    std::thread([&]() { log.record(tp, 0, 0, 2); }).join();
+    std::this_thread::sleep_for(millis{20});
+    std::thread([&]() { log.record(tp, 0, 0, 3); }).join();
+    done = true;
+    live.join();
+    log.stop();
+
+    std::set<std::string> threads;
+    std::istringstream is{read_file(path)};
+    for (std::string line; std::getline(is, line); )
+	threads.insert(line.substr(0, line.find('\t')));
+    EXPECT_EQ(threads.size(), 3);
+    std::remove(path.c_str());
+}
+
+TEST(TimeLog, FormatsRegisteredWhileFlushing)
+{
+    // Formats registered by producing threads while the flusher is running are rendered
+    // with their text rather than as unknown.
+    auto path = testing::TempDir() + "chrono_time_log_formats.txt";
+    auto& log = TimeLog::instance();
+    auto tp = "2024-07-01 12:00:00"_utc;
+    log.start(path, TimeLog::Output::Text, millis{1});
+
+    std::vector<std::thread> threads;
+    std::multiset<std::string> expected;
+    for (std::size_t t = 0; t < 2 * NumberThreads; ++t) {
+	auto fmt = fmt::format("%F thread {}", t);
+	for (std::size_t i = 0; i < NumberRecords; ++i)
+	    expected.insert(fmt::format("{}\t{}", t, tp.to_string(TimeZoneName{}, fmt)));
+	threads.emplace_back([&log, tp, t, fmt]() {
+	    auto format = TimeLog::format_id(fmt);
+	    for (std::size_t i = 0; i < NumberRecords; ++i)
+		log.record(tp, 0, format, t);
+	});
+    }
+    for (auto& thread : threads)
+	thread.join();
+    log.stop();
+
+    EXPECT_EQ(strip_thread(read_file(path)), expected);
+    std::remove(path.c_str());
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
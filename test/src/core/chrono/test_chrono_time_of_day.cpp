@@ -81,6 +81,48 @@ TEST(TimeOfDay, ConstructString)
     EXPECT_EQ(t5.to_duration(), chron::millis{5});
 }
 
+TEST(TimeOfDay, Compact)
+{
+    static_assert(sizeof(TimeOfDay) == sizeof(std::int64_t));
+    for (auto tod : sampler<TimeOfDay>() | take(NumberSamples)) {
+	auto base = (TimeOfDayBase)tod;
+	EXPECT_EQ(tod.hours(), base.hours());
+	EXPECT_EQ(tod.minutes(), base.minutes());
+	EXPECT_EQ(tod.seconds(), base.seconds());
+	EXPECT_EQ(tod.subseconds(), base.subseconds());
+	EXPECT_EQ(std::hash<TimeOfDay>{}(tod), std::hash<TimeOfDay>{}(TimeOfDay{base}));
+    }
+
+    TimeOfDay negative{-chron::minutes{90}};
+    EXPECT_TRUE(negative.is_negative());
+    EXPECT_EQ(negative.hours().count(), 1);
+    EXPECT_EQ(negative.minutes().count(), 30);
+}
+
+TEST(TimeOfDay, Arithmetic)
+{
+    TimeOfDay open{9, 30, 0}, close{16, 0, 0};
+    EXPECT_EQ(close - open, chron::minutes{390});
+    EXPECT_EQ(open + chron::minutes{390}, close);
+    EXPECT_EQ(close - chron::minutes{390}, open);
+    auto tod = open;
+    tod += chron::hours{1};
+    EXPECT_EQ(tod, TimeOfDay(10, 30, 0));
+    tod -= chron::nanos{1};
+    EXPECT_EQ(tod, TimeOfDay(10, 29, 59, 999'999'999));
+    EXPECT_LT(open, tod);
+}
+
+TEST(TimeOfDay, Literal)
+{
+    static_assert("09:30"_tod == TimeOfDay{9, 30, 0});
+    static_assert("9"_tod == TimeOfDay{9, 0, 0});
+    static_assert("16:00:01.5"_tod == TimeOfDay{16, 0, 1, 500'000'000});
+    static_assert("23:59:59.999999999"_tod == TimeOfDay::max());
+    static_assert("16:00"_tod - "09:30"_tod == chron::minutes{390});
+    EXPECT_EQ("12:34:56.789"_tod, TimeOfDay{"12:34:56.789"});
+}
+
 TEST(TimeOfDay, ToFromJson)
 {
     for (auto tod : sampler<TimeOfDay>() | take(NumberSamples)) {
@@ -158,6 +158,99 @@ TEST(TimePoint, Midnight)
     }
 }
 
+TEST(TimePoint, DaylightSaving)
+{
+    TimeZoneName tzname{"America/New_York"};
+    using Day = std::pair<Date, int>;
+    for (auto [date, hours] : {Day{mar/10/2024, 23}, Day{nov/3/2024, 25}, Day{mar/11/2024, 24}}) {
+	TimePoint begin{date, tzname}, end{date.tomorrow(), tzname};
+	EXPECT_EQ(end - begin, std::chrono::hours{hours});
+
+	auto last = end - nanos{1};
+	EXPECT_EQ(last.date(tzname), date);
+	EXPECT_EQ(last.midnight(tzname), begin);
+	EXPECT_EQ(last.next_midnight(tzname), end);
+	EXPECT_EQ(last.time_of_day(tzname).to_duration(), std::chrono::hours{hours} - nanos{1});
+	EXPECT_EQ(end.date(tzname), date.tomorrow());
+	EXPECT_EQ(end.midnight(tzname), end);
+    }
+}
+
+TEST(TimePoint, MatchesZonedTime)
+{
+    auto namer = tznamer();
+    auto fuzz = Sampler<std::int64_t>{}(-8'000'000'000'000'000'000, 8'000'000'000'000'000'000);
+    for (auto i = 0; i < 16 * NumberSamples; ++i) {
+	TimeZoneName tzname{namer.sample()};
+	TimePoint tp{fuzz.sample()};
+	auto tz = Date::locate_timezone(tzname);
+	auto local = date::zoned_time{tz, tp}.get_local_time();
+	Date expected{date::floor<date::days>(local)};
+	auto [date, tod] = tp.components(tzname);
+	EXPECT_EQ(date, expected);
+	EXPECT_EQ(tp.date(tzname), expected);
+	EXPECT_EQ(tp.midnight(tzname) + tod.to_duration(), tp);
+	EXPECT_LE(tp.midnight(tzname), tp);
+	EXPECT_GT(tp.next_midnight(tzname), tp);
+    }
+}
+
+// Check that the integer conversions for `zone` match the timezone database for the
+// equivalent timezone `tzname`.
+template<class Zone>
+void check_fixed_zone(Zone zone, const TimeZoneName& tzname) {
+    auto fuzz = Sampler<std::int64_t>{}(-8'000'000'000'000'000'000, 8'000'000'000'000'000'000);
+    for (auto i = 0; i < 16 * NumberSamples; ++i) {
+	TimePoint tp{fuzz.sample()};
+	auto [date, tod] = tp.components(zone);
+	EXPECT_EQ(date, tp.date(tzname));
+	EXPECT_EQ(tod, tp.time_of_day(tzname));
+	EXPECT_EQ(tp.date(zone), date);
+	EXPECT_EQ(tp.time_of_day(zone), tod);
+	EXPECT_EQ(tp.midnight(zone), tp.midnight(tzname));
+	EXPECT_EQ(tp.next_midnight(zone), tp.next_midnight(tzname));
+	EXPECT_EQ(TimePoint(date, tod, zone), tp);
+	EXPECT_EQ(date.to_timepoint(zone), date.to_timepoint(tzname));
+	EXPECT_EQ(Date(tp, zone), date);
+	EXPECT_EQ(tp.to_string(zone, "%F %T"), tp.to_string(tzname, "%F %T"));
+    }
+}
+
+TEST(TimePoint, Utc)
+{
+    check_fixed_zone(Utc{}, TimeZoneName{"Etc/UTC"});
+    check_fixed_zone(TimeZoneName{"UTC"}, TimeZoneName{"Etc/UTC"});
+    static_assert("2024-03-10 09:30:00"_utc.date() == Date{2024, 3, 10});
+    static_assert("2024-03-10 09:30:00"_utc.time_of_day(Utc{}) == "09:30"_tod);
+    static_assert("2024-03-10 09:30:00"_utc.midnight() == "2024-03-10"_utc);
+    static_assert(TimePoint{Date{2024, 3, 10}, "09:30"_tod} == "2024-03-10 09:30:00"_utc);
+    EXPECT_EQ("2024-03-10 09:30:00.5"_utc.to_string(), "2024-03-10 09:30:00.500000000");
+    EXPECT_EQ("2024-03-10 09:30:00"_utc.to_string(Utc{}, "%F %Z"), "2024-03-10 UTC");
+}
+
+TEST(TimePoint, FixedOffset)
+{
+    // The POSIX style Etc zones have the opposite sign to ISO 8601 offsets.
+    check_fixed_zone(FixedOffset{"-05:00"}, TimeZoneName{"Etc/GMT+5"});
+    check_fixed_zone(FixedOffset{"+10"}, TimeZoneName{"Etc/GMT-10"});
+
+    constexpr FixedOffset plus_one{std::chrono::hours{1}};
+    static_assert("2024-03-10 23:30:00"_utc.date(plus_one) == Date{2024, 3, 11});
+    static_assert("2024-03-10 23:30:00"_utc.time_of_day(plus_one) == "00:30"_tod);
+    static_assert(Date{2024, 3, 11}.to_timepoint(plus_one) == "2024-03-10 23:00"_utc);
+
+    FixedOffset india{"+05:30"};
+    EXPECT_EQ(india.offset(), std::chrono::minutes{330});
+    EXPECT_EQ(india.to_string(), "+05:30");
+    EXPECT_EQ(FixedOffset{"-0930"}.to_string(), "-09:30");
+    EXPECT_EQ(FixedOffset{"Z"}, FixedOffset{Utc{}});
+    EXPECT_EQ("2024-03-10 12:00:00"_utc.to_string(india, "%F %H:%M %z"), "2024-03-10 17:30 +0530");
+    EXPECT_THROW(FixedOffset{"05:30"}, std::runtime_error);
+    EXPECT_THROW(FixedOffset{"+05:60"}, std::runtime_error);
+    EXPECT_THROW(FixedOffset{"+05:3"}, std::runtime_error);
+    EXPECT_THROW(FixedOffset{std::chrono::hours{24}}, std::runtime_error);
+}
+
 TEST(TimePoint, UnixTs)
 {
     for (auto tp : sampler<TimePoint>() | take(NumberSamples)) {
@@ -168,6 +261,20 @@ TEST(TimePoint, UnixTs)
     }
 }
 
+TEST(TimePoint, Constexpr)
+{
+    static_assert(TimePoint::epoch() == TimePoint{std::int64_t{0}});
+    static_assert(TimePoint::max().time_since_epoch().count() ==
+		  std::numeric_limits<std::int64_t>::max());
+    static_assert(TimePoint{1.5}.unix_ts() == 1.5);
+    static_assert("1970-01-02"_utc == TimePoint{std::int64_t{86'400'000'000'000}});
+    static_assert("2024-03-10 09:30:00"_utc < "2024-03-10T09:30:00.000000001"_utc);
+    EXPECT_EQ("2024-03-10 09:30:00"_utc, TimePoint("2024-03-10 09:30:00"));
+    EXPECT_EQ("2024-03-10 09:30:01.25"_utc, TimePoint("2024-03-10 09:30:01.25"));
+    EXPECT_EQ("1969-12-31 23:59"_utc, TimePoint{std::int64_t{-60'000'000'000}});
+    EXPECT_EQ("2024-02-29"_utc, TimePoint(Date(2024, 2, 29)));
+}
+
 TEST(TimePoint, DurationArithmetic)
 {
     core::mp::foreach<DurationAll>([]<class T>() {
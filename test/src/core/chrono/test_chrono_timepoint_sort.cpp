@@ -0,0 +1,103 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include "core/chrono/timepoint_sort.h"
+#include "coro/stream/stream.h"
+
+using namespace chron;
+using namespace coro;
+
+static const int NumberSamples = 10'000;
+
+static std::vector<TimePoint> timepoints(std::int64_t min, std::int64_t max) {
+    std::vector<TimePoint> tps;
+    for (auto nanos : sampler<std::int64_t>(min, max) | take(NumberSamples))
+	tps.push_back(TimePoint{nanos});
+    return tps;
+}
+
+TEST(TimePointSort, RadixSort)
+{
+    auto limit = std::numeric_limits<std::int64_t>::max();
+    for (auto [min, max] : {std::pair{-limit, limit},
+			    std::pair{std::int64_t{0}, std::int64_t{1'000'000}},
+			    std::pair{std::int64_t{-1'000}, std::int64_t{1'000}}}) {
+	auto tps = timepoints(min, max);
+	auto expected = tps;
+	std::sort(expected.begin(), expected.end());
+	radix_sort(tps);
+	EXPECT_EQ(tps, expected);
+    }
+
+    std::vector<TimePoint> empty;
+    radix_sort(empty);
+    EXPECT_TRUE(empty.empty());
+}
+
+TEST(TimePointSort, RadixSortPayload)
+{
+    auto tps = timepoints(-1'000, 1'000);
+    std::vector<std::uint32_t> indices(tps.size());
+    std::iota(indices.begin(), indices.end(), 0);
+    auto original = tps;
+    radix_sort(std::span{tps}, std::span{indices});
+    EXPECT_TRUE(std::is_sorted(tps.begin(), tps.end()));
+    for (std::size_t i = 0; i < tps.size(); ++i) {
+	EXPECT_EQ(original[indices[i]], tps[i]);
+	if (i > 0 and tps[i] == tps[i - 1]) {
+	    EXPECT_LT(indices[i - 1], indices[i]);
+	}
+    }
+
+    EXPECT_EQ(radix_argsort(original), indices);
+
+    std::vector<double> wrong(1);
+    EXPECT_THROW(radix_sort(std::span{tps}, std::span{wrong}), std::runtime_error);
+}
+
+TEST(TimePointSort, Merge)
+{
+    std::vector<std::vector<TimePoint>> feeds;
+    std::vector<std::span<const TimePoint>> inputs;
+    for (auto k = 0; k < 7; ++k) {
+	auto tps = timepoints(0, 1'000);
+	tps.resize(k * 100);
+	std::sort(tps.begin(), tps.end());
+	feeds.push_back(tps);
+    }
+    feeds.push_back({TimePoint::max(), TimePoint::max()});
+    for (const auto& feed : feeds)
+	inputs.push_back(feed);
+
+    std::vector<TimePoint> expected;
+    for (const auto& feed : feeds)
+	expected.insert(expected.end(), feed.begin(), feed.end());
+    std::stable_sort(expected.begin(), expected.end());
+
+    std::vector<TimePoint> output(expected.size());
+    std::vector<std::uint32_t> sources(expected.size());
+    merge_sorted(inputs, output, sources);
+    EXPECT_EQ(output, expected);
+
+    std::vector<std::size_t> positions(feeds.size(), 0);
+    for (std::size_t i = 0; i < output.size(); ++i) {
+	auto s = sources[i];
+	EXPECT_EQ(feeds[s][positions[s]++], output[i]);
+	if (i > 0 and output[i] == output[i - 1]) {
+	    EXPECT_LE(sources[i - 1], sources[i]);
+	}
+    }
+
+    EXPECT_EQ(merge_sorted(inputs), expected);
+    EXPECT_TRUE(merge_sorted(std::span<const std::span<const TimePoint>>{}).empty());
+    EXPECT_THROW(merge_sorted(inputs, std::span{output}.first(1)), std::runtime_error);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
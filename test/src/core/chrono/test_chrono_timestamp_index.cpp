@@ -0,0 +1,119 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include "core/chrono/chrono.h"
+#include "core/chrono/timestamp_index.h"
+#include "coro/stream/stream.h"
+
+using namespace chron;
+using namespace coro;
+
+static const int NumberSamples = 10'000;
+
+static const TimeZoneName NewYork{"America/New_York"};
+
+// Return sorted timestamps over a few days around the March 2024 DST transition with
+// bursts of duplicates.
+static std::vector<TimePoint> timepoints() {
+    TimePoint start{mar/8/2024, NewYork};
+    auto span = (TimePoint{mar/13/2024, NewYork} - start).count();
+    std::vector<TimePoint> tps;
+    for (auto nanos : sampler<std::int64_t>(0, span) | take(NumberSamples))
+	tps.push_back(start + chron::nanos{nanos});
+    for (auto i = 0; i < 200; ++i)
+	tps.push_back(start + std::chrono::hours{30});
+    std::sort(tps.begin(), tps.end());
+    return tps;
+}
+
+TEST(TimestampIndex, Search)
+{
+    auto tps = timepoints();
+    auto path = testing::TempDir() + "timestamp_index.idx";
+    for (auto max_error : {0u, 4u, 32u}) {
+	TimestampIndex::write(path, tps, max_error);
+	TimestampIndex index{path};
+	ASSERT_EQ(index.size(), tps.size());
+	EXPECT_EQ(index.max_error(), max_error);
+	EXPECT_GT(index.segments(), 0u);
+	for (std::size_t i = 0; i < tps.size(); ++i)
+	    ASSERT_EQ(index[i], tps[i]);
+
+	auto queries = tps;
+	for (auto tp : tps) {
+	    queries.push_back(tp - nanos{1});
+	    queries.push_back(tp + nanos{1});
+	}
+	queries.push_back(TimePoint::epoch());
+	queries.push_back(TimePoint::max());
+	for (auto tp : queries) {
+	    auto lower = std::lower_bound(tps.begin(), tps.end(), tp) - tps.begin();
+	    auto upper = std::upper_bound(tps.begin(), tps.end(), tp) - tps.begin();
+	    ASSERT_EQ(index.lower_bound(tp), std::size_t(lower));
+	    ASSERT_EQ(index.upper_bound(tp), std::size_t(upper));
+	}
+    }
+    std::remove(path.c_str());
+}
+
+TEST(TimestampIndex, DateRange)
+{
+    auto tps = timepoints();
+    auto path = testing::TempDir() + "timestamp_index.idx";
+    TimestampIndex::write(path, tps);
+    TimestampIndex index{path};
+
+    std::size_t total{0};
+    for (Date date = mar/8/2024; date < mar/13/2024; ++date) {
+	auto [first, last] = index.on(date, NewYork);
+	auto count = std::count_if(tps.begin(), tps.end(), [&](const TimePoint& tp) {
+	    return tp.date(NewYork) == date;
+	});
+	EXPECT_EQ(last - first, std::size_t(count));
+	for (auto i = first; i < last; ++i)
+	    EXPECT_EQ(index[i].date(NewYork), date);
+	total += last - first;
+    }
+    EXPECT_EQ(total, tps.size());
+
+    auto [first, last] = index.between(mar/9/2024, mar/11/2024, NewYork);
+    EXPECT_EQ(first, index.on(mar/9/2024, NewYork).first);
+    EXPECT_EQ(last, index.on(mar/10/2024, NewYork).second);
+    std::remove(path.c_str());
+}
+
+TEST(TimestampIndex, Empty)
+{
+    auto path = testing::TempDir() + "timestamp_index.idx";
+    TimestampIndex::write(path, {});
+    TimestampIndex index{path};
+    EXPECT_EQ(index.size(), 0u);
+    EXPECT_EQ(index.lower_bound(TimePoint::epoch()), 0u);
+    EXPECT_EQ(index.upper_bound(TimePoint::max()), 0u);
+
+    auto moved = std::move(index);
+    EXPECT_EQ(moved.size(), 0u);
+    std::remove(path.c_str());
+}
+
+TEST(TimestampIndex, Errors)
+{
+    auto path = testing::TempDir() + "timestamp_index.idx";
+    std::vector<TimePoint> unsorted{TimePoint{std::int64_t{2}}, TimePoint{std::int64_t{1}}};
+    EXPECT_THROW(TimestampIndex::write(path, unsorted), std::runtime_error);
+
+    std::ofstream{path} << std::string(128, 'x');
+    EXPECT_THROW(TimestampIndex{path}, std::runtime_error);
+    std::remove(path.c_str());
+    EXPECT_THROW(TimestampIndex{path}, std::runtime_error);
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
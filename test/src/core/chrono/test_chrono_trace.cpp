@@ -0,0 +1,164 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <regex>
+#include <set>
+#include <sstream>
+#include "core/chrono/trace.h"
+
+using namespace chron;
+
+static std::size_t count_of(const std::string& str, const std::string& pattern) {
+    std::size_t count{0};
+    for (auto pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1))
+	++count;
+    return count;
+}
+
+TEST(SpscRing, PushPop)
+{
+    SpscRing<int> ring{3};
+    EXPECT_EQ(ring.capacity(), 4);
+    EXPECT_TRUE(ring.empty());
+    for (auto i = 0; i < 4; ++i)
+	EXPECT_TRUE(ring.push(i));
+    EXPECT_FALSE(ring.push(4));
+
+    int value;
+    EXPECT_TRUE(ring.pop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(ring.push(4));
+
+    std::vector<int> values;
+    EXPECT_EQ(ring.consume([&](int v) { values.push_back(v); }), 4);
+    EXPECT_EQ(values, (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_FALSE(ring.pop(value));
+}
+
+TEST(SpscRing, Threads)
+{
+    SpscRing<std::int64_t> ring{64};
+    const std::int64_t count = 100'000;
+    std::thread producer([&]() {
+	for (std::int64_t i = 0; i < count; ++i)
+	    while (not ring.push(i))
+		std::this_thread::yield();
+    });
+
+    std::int64_t expected{0}, value;
+    while (expected < count)
+	if (ring.pop(value))
+	    EXPECT_EQ(value, expected++);
+	else
+	    std::this_thread::yield();
+    producer.join();
+}
+
+TEST(Tracer, ChromeTrace)
+{
+    auto path = testing::TempDir() + "chrono_trace.json";
+    auto& tracer = Tracer::instance();
+
+    auto outer = Tracer::name_id("outer");
+    auto inner = Tracer::name_id("inner");
+    EXPECT_EQ(Tracer::name_id("outer"), outer);
+    EXPECT_NE(inner, outer);
+
+    {
+	TraceSpan span{outer};
+	EXPECT_FALSE(tracer.enabled());
+    }
+
+    tracer.start(path, millis{1});
+    EXPECT_TRUE(tracer.enabled());
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < 4; ++i)
+	threads.emplace_back([&]() {
+	    for (auto j = 0; j < 100; ++j) {
+		TraceSpan span{outer};
+		TraceSpan nested{inner};
+	    }
+	});
+    for (auto& thread : threads)
+	thread.join();
+    tracer.stop();
+    EXPECT_FALSE(tracer.enabled());
+    EXPECT_EQ(tracer.dropped(), 0);
+
+    std::ifstream ifs{path};
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    auto str = ss.str();
+    EXPECT_EQ(str.substr(0, 16), "{\"displayTimeUni");
+    EXPECT_EQ(count_of(str, "\"ph\":\"X\""), 800);
+    EXPECT_EQ(count_of(str, "\"name\":\"outer\""), 400);
+    EXPECT_EQ(str.substr(str.size() - 3), "]}\n");
+    std::remove(path.c_str());
+}
+
+// Return the file at `path` as a string.
+static std::string read_file(const std::string& path) {
+    std::ifstream ifs{path};
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    return ss.str();
+}
+
+TEST(Tracer, EscapedNames)
+{
+    auto path = testing::TempDir() + "chrono_trace_escaped.json";
+    auto& tracer = Tracer::instance();
+    auto id = Tracer::name_id("say \"hi\"\\\n");
+    tracer.start(path, millis{1});
+    {
+	TraceSpan span{id};
+    }
+    tracer.stop();
+
+    auto str = read_file(path);
+    EXPECT_EQ(count_of(str, "\"name\":\"say \\\"hi\\\"\\\\\\n\""), 1) << str;
+    std::remove(path.c_str());
+}
+
+TEST(Tracer, UniqueThreadIds)
+{
+    // A thread that starts after another has exited and been drained gets a new id while
+    // an older thread is still live.
+    auto path = testing::TempDir() + "chrono_trace_tids.json";
+    auto& tracer = Tracer::instance();
+    auto first = Tracer::name_id("first"), second = Tracer::name_id("second"),
+	third = Tracer::name_id("third");
+    tracer.start(path, millis{1});
+
+    std::atomic<bool> done{false};
+    std::thread live([&]() {
+	{ TraceSpan span{first}; }
+	while (not done)
+	    std::this_thread::yield();
+    });
+    std::thread([&]() { TraceSpan span{second}; }).join();
+    std::this_thread::sleep_for(millis{20});
+    std::thread([&]() { TraceSpan span{third}; }).join();
+    done = true;
+    live.join();
+    tracer.stop();
+
+    auto str = read_file(path);
+    std::map<std::string, std::string> tids;
+    std::regex pattern{"\"name\":\"(first|second|third)\".*?\"tid\":([0-9]+)"};
+    for (std::sregex_iterator iter{str.begin(), str.end(), pattern}, end; iter != end; ++iter)
+	tids[(*iter)[1]] = (*iter)[2];
+    ASSERT_EQ(tids.size(), 3) << str;
+    EXPECT_EQ((std::set<std::string>{tids["first"], tids["second"], tids["third"]}).size(), 3);
+    std::remove(path.c_str());
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,98 @@
+// Copyright 2022 by Mark Melton
+//
+
+#include <gtest/gtest.h>
+#include "core/chrono/chrono_stream.h"
+#include "core/chrono/zoned_timepoint.h"
+
+using namespace chron;
+using namespace coro;
+
+static const int NumberSamples = 1024;
+
+auto tznamer() {
+    return repeat("EST") * repeat("CST") * repeat("UTC") * repeat("Europe/Berlin")
+	* repeat("Australia/Lord_Howe") | choose();
+}
+
+TEST(ZonedTimePoint, Size)
+{
+    EXPECT_LE(sizeof(ZonedTimePoint), 16);
+}
+
+TEST(ZonedTimePoint, MatchesTimePoint)
+{
+    auto namer = tznamer();
+    auto fuzz = Sampler<std::int64_t>{}(-8'000'000'000'000'000'000, 8'000'000'000'000'000'000);
+    for (auto i = 0; i < NumberSamples; ++i) {
+	TimeZoneName tzname{namer.sample()};
+	TimePoint tp{fuzz.sample()};
+	ZonedTimePoint ztp{tp, tzname};
+	EXPECT_EQ(ztp.timepoint(), tp);
+	EXPECT_EQ(TimePoint{ztp}, tp);
+	EXPECT_EQ(ztp.date(), tp.date(tzname));
+	EXPECT_EQ(ztp.time_of_day(), tp.time_of_day(tzname));
+	EXPECT_EQ(ztp.components(), tp.components(tzname));
+	EXPECT_EQ(ztp.to_string(), tp.to_string(tzname));
+	EXPECT_EQ(ztp.to_string("%F %T %Z %z"), tp.to_string(tzname, "%F %T %Z %z"));
+    }
+}
+
+TEST(ZonedTimePoint, Sequential)
+{
+    // Consecutive instants through the days of the spring forward and fall back
+    // transitions reuse the cached offset until the transition.
+    TimeZoneName tzname{"America/New_York"};
+    for (Date date : {mar/10/2024, nov/3/2024}) {
+	auto end = TimePoint{date.tomorrow(), tzname} + minutes{1};
+	for (auto tp = TimePoint{date, tzname} - minutes{1}; tp <= end; tp += minutes{1}) {
+	    ZonedTimePoint ztp{tp, tzname};
+	    EXPECT_EQ(ztp.components(), tp.components(tzname));
+	    EXPECT_EQ(ztp.to_string("%F %T %z"), tp.to_string(tzname, "%F %T %z"));
+	}
+    }
+}
+
+TEST(ZonedTimePoint, ZoneId)
+{
+    EXPECT_EQ(ZonedTimePoint::zone_id(TimeZoneName{"UTC"}), 0);
+    EXPECT_EQ(ZonedTimePoint::zone(0), nullptr);
+
+    auto id = ZonedTimePoint::zone_id(TimeZoneName{"America/New_York"});
+    EXPECT_NE(id, 0);
+    EXPECT_EQ(ZonedTimePoint::zone_id(TimeZoneName{"EST"}), id);
+    EXPECT_EQ(ZonedTimePoint::zone(id), Date::locate_timezone("America/New_York"));
+    EXPECT_NE(ZonedTimePoint::zone_id(TimeZoneName{"Europe/Berlin"}), id);
+    EXPECT_THROW(ZonedTimePoint::zone(1000), std::runtime_error);
+
+    auto tp = "2024-07-01 12:00:00"_utc;
+    ZonedTimePoint ztp{tp, id};
+    EXPECT_EQ(ztp.zone_id(), id);
+    EXPECT_EQ(ztp.zone_name(), "America/New_York");
+    EXPECT_EQ(ztp.offset(), -hours{4});
+    EXPECT_EQ(ztp, (ZonedTimePoint{tp, TimeZoneName{"America/New_York"}}));
+    EXPECT_EQ(ztp.in(TimeZoneName{"Europe/Berlin"}).time_of_day(), "14:00"_tod);
+}
+
+TEST(ZonedTimePoint, FixedOffset)
+{
+    constexpr ZonedTimePoint utc{"2024-03-10 23:30:00"_utc};
+    static_assert(utc.date() == Date{2024, 3, 10});
+    static_assert(utc.time_of_day() == "23:30"_tod);
+    EXPECT_EQ(utc.zone_name(), "UTC");
+
+    constexpr ZonedTimePoint india{"2024-03-10 23:30:00"_utc, FixedOffset{std::chrono::minutes{330}}};
+    static_assert(india.date() == Date{2024, 3, 11});
+    static_assert(india.time_of_day() == "05:00"_tod);
+    static_assert(india.offset() == minutes{330});
+    EXPECT_EQ(india.zone_name(), "+05:30");
+    EXPECT_EQ(india.to_string("%F %H:%M %Z"), "2024-03-11 05:00 +05:30");
+    EXPECT_NE(india, utc);
+    EXPECT_EQ(india.timepoint(), utc.timepoint());
+}
+
+int main(int argc, char *argv[])
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,43 @@
+// Copyright 2022 by Mark Melton
+//
+
+// Decode a binary time log written by **TimeLog** into text, one line per record with the
+// thread number, the tag and the formatted timestamp separated by tabs.
+//
+//     chrono_time_log_decode <log> [<output>]
+
+#include <fstream>
+#include <iostream>
+#include "core/chrono/time_log.h"
+
+using namespace chron;
+
+int main(int argc, char *argv[]) {
+    if (argc < 2 or argc > 3) {
+	std::cerr << "usage: " << argv[0] << " <log> [<output>]" << std::endl;
+	return 1;
+    }
+
+    std::ifstream ifs{argv[1], std::ios::binary};
+    if (not ifs.good()) {
+	std::cerr << argv[0] << ": failed to open " << argv[1] << std::endl;
+	return 1;
+    }
+
+    std::ofstream ofs;
+    if (argc == 3) {
+	ofs.open(argv[2]);
+	if (not ofs.good()) {
+	    std::cerr << argv[0] << ": failed to open " << argv[2] << std::endl;
+	    return 1;
+	}
+    }
+
+    try {
+	TimeLog::decode(ifs, argc == 3 ? ofs : std::cout);
+    } catch (const std::exception& error) {
+	std::cerr << argv[0] << ": " << error.what() << std::endl;
+	return 1;
+    }
+    return 0;
+}